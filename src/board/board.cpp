@@ -0,0 +1,285 @@
+/*
+	License: Zlib
+	see https://gitlab.com/cam900/vgsound_emu/-/blob/main/LICENSE for more details
+
+	Copyright holder(s): cam900
+	Board of sound chips with common host sample rate
+
+	Each chip runs at its own output rate (input clock / divider), board
+   converts them into single host sample rate and mixes them into interleaved
+   stereo buffer.
+
+	Chip is advanced in runs of ticks for each host sample, and output of run
+   is averaged (box filter); if chip output rate is slower than host sample
+   rate, last output is held until next tick.
+
+	Output gain is 8 bit fraction, and default gain of each devices is roughly
+   normalized into 16 bit range. Output is not clamped.
+
+	Auto sleep stops chips while their output is settled: if chip is idle
+   (every voices are stopped, and output is silence or DC) at start of render,
+   that render is executed normally and its held output becomes exact, then
+   following renders only add held output and count skipped ticks. Chip is
+   woken up by host accesses (write, read, sample memory, control including
+   gain, and reset), and skipped ticks are applied into chip state before
+   the access, so output is bit exact with auto sleep disabled. If every chips
+   are sleeping, board only fills buffer with sum of held outputs.
+
+	Devices for each chips are in board_devices.hpp.
+
+	Host accesses of devices can be recorded into trace, see board_trace.cpp.
+*/
+
+#include "board.hpp"
+#include "board_trace.hpp"
+
+void board_device::write(u32 address, u32 data)
+{
+	if (m_trace != nullptr)
+	{
+		m_trace->write(m_time, m_index, address, data);
+	}
+	wake();
+	host_w(address, data);
+}
+
+u32 board_device::read(u32 address)
+{
+	wake();
+	const u32 ret = host_r(address);
+	if (m_trace != nullptr)
+	{
+		m_trace->read(m_time, m_index, address, ret);
+	}
+	return ret;
+}
+
+void board_device::set_rom(u8 region, const u8 *data, u32 size)
+{
+	if (m_trace != nullptr)
+	{
+		m_trace->rom(m_time, m_index, region, data, size);
+	}
+	wake();
+	rom_w(region, data, size);
+}
+
+void board_device::control(u32 address, u32 data)
+{
+	if (m_trace != nullptr)
+	{
+		m_trace->control(m_time, m_index, address, data);
+	}
+	wake();
+	switch (address)
+	{
+		case CONTROL_GAIN: m_gain = s32(data); break;  // held output is scaled with gain
+		default: control_w(address, data); break;
+	}
+}
+
+void board_device::reset()
+{
+	if (m_trace != nullptr)
+	{
+		m_trace->reset(m_time, m_index);
+	}
+	m_frac	= 0;
+	m_sleep = false;
+	m_skip	= 0;
+	m_hold.fill(0);
+}
+
+void board_device::serialize(serializer_t &s)
+{
+	// skipped ticks are applied before save, sleep is restarted after load
+	if (s.loading())
+	{
+		m_sleep = false;
+		m_skip	= 0;
+	}
+	else if (m_skip > 0)
+	{
+		skip_idle(m_skip);
+		m_skip = 0;
+	}
+	s.item(m_clock);
+	s.item(m_flags);
+	s.item(m_rate);
+	s.item(m_frac);
+	s.item(m_hold);
+}
+
+void board_device::set_trace(board_trace_writer *trace, u8 index)
+{
+	m_trace = trace;
+	m_index = index;
+	m_time	= 0;
+	if (m_trace != nullptr)
+	{
+		m_trace->device(m_time, m_index, m_kind, m_clock, m_flags);
+	}
+}
+
+void board_device::set_auto_sleep(bool sleep)
+{
+	if (!sleep)
+	{
+		wake();
+	}
+	m_auto_sleep = sleep;
+}
+
+void board_device::render(s32 *out, u32 samples, u32 rate)
+{
+	if (rate == 0)
+	{
+		return;
+	}
+
+	if (m_sleep)
+	{
+		for (u32 s = 0; s < samples; s++)
+		{
+			out[(s << 1) + 0] += m_hold[0];
+			out[(s << 1) + 1] += m_hold[1];
+		}
+		sleep(samples, rate);
+		return;
+	}
+
+	// every ticks of idle chip have same output, so held output is exact after any tick
+	const bool idle = m_auto_sleep && this->idle();
+	bool ran		= false;
+	for (u32 s = 0; s < samples; s++)
+	{
+		m_frac			+= m_rate;
+		const u32 ticks = m_frac / rate;
+		if (ticks > 0)
+		{
+			m_frac	  -= ticks * rate;
+			s64 left  = 0;
+			s64 right = 0;
+			run(ticks, left, right);
+			m_hold[0] = s32(((left / s64(ticks)) * m_gain) >> 8);
+			m_hold[1] = s32(((right / s64(ticks)) * m_gain) >> 8);
+			ran		  = true;
+		}
+		out[(s << 1) + 0] += m_hold[0];
+		out[(s << 1) + 1] += m_hold[1];
+	}
+	m_sleep	= idle && ran;
+	m_time += samples;
+}
+
+// apply skipped ticks, chip is run from next render
+void board_device::wake()
+{
+	if (m_skip > 0)
+	{
+		skip_idle(m_skip);
+	}
+	m_sleep = false;
+	m_skip	= 0;
+}
+
+// advance rate conversion without running chip, same as render
+void board_device::sleep(u32 samples, u32 rate)
+{
+	const u64 frac = u64(m_frac) + (u64(m_rate) * samples);
+	m_skip		  += frac / rate;
+	m_frac		   = u32(frac % rate);
+	m_slept		  += samples;
+	m_time		  += samples;
+}
+
+void board_core::attach(board_device &device) { m_device.push_back(&device); }
+
+void board_core::detach_all() { m_device.clear(); }
+
+void board_core::reset()
+{
+	for (board_device *elem : m_device)
+	{
+		elem->reset();
+	}
+}
+
+void board_core::serialize(serializer_t &s)
+{
+	for (board_device *elem : m_device)
+	{
+		elem->serialize(s);
+	}
+}
+
+void board_core::render(s32 *out, u32 samples)
+{
+	bool sleep = (m_rate != 0) && (!m_device.empty());
+	for (board_device *elem : m_device)
+	{
+		sleep = sleep && elem->sleeping();
+	}
+
+	// every chips are sleeping, output is silence or DC
+	if (sleep)
+	{
+		s32 left  = 0;
+		s32 right = 0;
+		for (board_device *elem : m_device)
+		{
+			left  += elem->m_hold[0];
+			right += elem->m_hold[1];
+			elem->sleep(samples, m_rate);
+		}
+		if ((left == 0) && (right == 0))
+		{
+			std::memset(out, 0, sizeof(s32) * (samples << 1));
+		}
+		else
+		{
+			for (u32 s = 0; s < samples; s++)
+			{
+				out[(s << 1) + 0] = left;
+				out[(s << 1) + 1] = right;
+			}
+		}
+		m_slept += samples;
+		m_time	+= samples;
+		return;
+	}
+
+	std::fill_n(out, samples << 1, 0);
+	for (board_device *elem : m_device)
+	{
+		elem->render(out, samples, m_rate);
+	}
+	m_time += samples;
+}
+
+void board_core::set_auto_sleep(bool sleep)
+{
+	for (board_device *elem : m_device)
+	{
+		elem->set_auto_sleep(sleep);
+	}
+}
+
+void board_core::set_trace(board_trace_writer *trace)
+{
+	if (m_trace != nullptr)
+	{
+		m_trace->sync(m_time);	// keep length of trace
+	}
+
+	m_trace = trace;
+	m_time	= 0;
+	if (m_trace != nullptr)
+	{
+		m_trace->start(m_rate);
+	}
+	for (u32 i = 0; i < m_device.size(); i++)
+	{
+		m_device[i]->set_trace(m_trace, u8(i));
+	}
+}
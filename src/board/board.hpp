@@ -0,0 +1,226 @@
+/*
+	License: Zlib
+	see https://gitlab.com/cam900/vgsound_emu/-/blob/main/LICENSE for more details
+
+	Copyright holder(s): cam900
+	Board of sound chips with common host sample rate
+
+	See board.cpp for more info.
+*/
+
+#ifndef _VGSOUND_EMU_SRC_BOARD_BOARD_HPP
+#define _VGSOUND_EMU_SRC_BOARD_BOARD_HPP
+
+#pragma once
+
+#include "../core/util.hpp"
+
+class board_trace_writer;
+
+// Sound chip attached to board, converts chip output rate to host sample rate
+class board_device : public vgsound_emu_core
+{
+		friend class board_core;  // whole board sleep
+
+	public:
+		// chip types, for recreating device from trace
+		enum kind_t : u8
+		{
+			KIND_SCC = 0,  // K051649/K052539, flags bit 0: SCC+
+			KIND_K007232,
+			KIND_K053260,
+			KIND_MSM6295,  // flags bit 0: SS pin
+			KIND_X1_010,
+			KIND_ES5505,
+			KIND_ES5506,
+			KIND_COUNT
+		};
+
+		// device settings for control, common for every devices
+		// chip specific settings are below CONTROL_DEVICE
+		enum device_control_t : u32
+		{
+			CONTROL_DEVICE = 0x80000000,
+			CONTROL_GAIN   = CONTROL_DEVICE,  // output gain, s32
+		};
+
+		// constructor
+		board_device(std::string tag, u8 kind, u32 clock, u32 flags, u32 rate, s32 gain = 0x100)
+			: vgsound_emu_core(tag)
+			, m_kind(kind)
+			, m_clock(clock)
+			, m_flags(flags)
+			, m_rate(rate)
+			, m_gain(gain)
+			, m_frac(0)
+			, m_hold{0}
+			, m_auto_sleep(false)
+			, m_sleep(false)
+			, m_skip(0)
+			, m_slept(0)
+			, m_trace(nullptr)
+			, m_index(0)
+			, m_time(0)
+		{
+		}
+
+		virtual ~board_device() {}
+
+		// host accessors, address and data format is chip specific
+		void write(u32 address, u32 data);
+		u32 read(u32 address);
+
+		// sample memory for each region, memory must be alive while attached
+		void set_rom(u8 region, const u8 *data, u32 size);
+
+		// device settings outside of register map, format is chip specific
+		// except settings of board device itself (device_control_t)
+		void control(u32 address, u32 data);
+
+		// internal state
+		virtual void reset();
+
+		// save state of device and chip, sample memory and gain aren't included
+		virtual void serialize(serializer_t &s);
+
+		// mix interleaved stereo output into buffer, rate is host sample rate
+		void render(s32 *out, u32 samples, u32 rate);
+
+		// record accesses into trace, nullptr for disable; trace time is restarted
+		void set_trace(board_trace_writer *trace, u8 index);
+
+		// auto sleep, chip isn't run while output is settled (silence or DC)
+		// host accesses wake chip up, skipped ticks are applied before access
+		void set_auto_sleep(bool sleep);
+
+		// setters
+		inline void set_gain(s32 gain) { control(CONTROL_GAIN, u32(gain)); }
+
+		// getters
+		inline u8 kind() { return m_kind; }
+
+		inline u32 clock() { return m_clock; }
+
+		inline u32 flags() { return m_flags; }
+
+		inline u32 rate() { return m_rate; }
+
+		inline s32 gain() { return m_gain; }
+
+		inline bool auto_sleep() { return m_auto_sleep; }
+
+		inline bool sleeping() { return m_sleep; }
+
+		inline u64 slept() { return m_slept; }	// host samples rendered in sleep
+
+	protected:
+		// chip specific accessors
+		virtual void host_w(u32 address, u32 data) = 0;
+
+		virtual u32 host_r(u32 address) { return 0; }
+
+		virtual void rom_w(u8 region, const u8 *data, u32 size) {}
+
+		virtual void control_w(u32 address, u32 data) {}
+
+		// change chip output rate, for clock or divider changes
+		inline void set_rate(u32 rate) { m_rate = rate; }
+
+		// change input clock and flags, for recreating device from trace
+		inline void set_clock_flags(u32 clock, u32 flags)
+		{
+			m_clock = clock;
+			m_flags = flags;
+		}
+
+		// run chip for ticks and add each output into sum, ticks is always non-zero
+		virtual void run(u32 ticks, s64 &left, s64 &right) = 0;
+
+		// silence detection, true if output of following ticks is unchanged until host access
+		virtual bool idle() { return false; }
+
+		// advance ticks in idle state, same as run() without output
+		virtual void skip_idle(u64 ticks) {}
+
+	private:
+		void wake();
+		void sleep(u32 samples, u32 rate);
+
+		u8 m_kind				  = 0;		// chip type
+		u32 m_clock				  = 0;		// input clock
+		u32 m_flags				  = 0;		// chip specific flags
+		u32 m_rate				  = 0;		// chip output rate
+		s32 m_gain				  = 0x100;	// output gain, 8 bit fraction
+		u32 m_frac				  = 0;		// rate conversion fraction
+		std::array<s32, 2> m_hold = {0};	// last host sample, for chip slower than host
+
+		bool m_auto_sleep = false;	// auto sleep enable
+		bool m_sleep	  = false;	// sleeping, output is m_hold
+		u64 m_skip		  = 0;		// ticks skipped in sleep
+		u64 m_slept		  = 0;		// host samples rendered in sleep
+
+		board_trace_writer *m_trace = nullptr;	// access recorder
+		u8 m_index					= 0;		// device index in trace
+		u64 m_time					= 0;		// rendered host samples since trace start
+};
+
+// Board, mixes every attached chips at host sample rate
+class board_core : public vgsound_emu_core
+{
+	public:
+		// constructor
+		board_core(u32 rate = 44100)
+			: vgsound_emu_core("board")
+			, m_rate(rate)
+			, m_device()
+			, m_slept(0)
+			, m_trace(nullptr)
+			, m_time(0)
+		{
+		}
+
+		// attach chip, device is not owned by board
+		void attach(board_device &device);
+		void detach_all();
+
+		// internal state
+		void reset();
+
+		// save state of every attached chips, in attached order
+		void serialize(serializer_t &s);
+
+		// render interleaved stereo output, buffer is cleared before mixing
+		// if every chips are sleeping, buffer is filled with sum of held outputs
+		void render(s32 *out, u32 samples);
+
+		// auto sleep of every attached chips
+		void set_auto_sleep(bool sleep);
+
+		// record accesses of every attached chips into trace, nullptr for stop
+		void set_trace(board_trace_writer *trace);
+
+		// setters
+		inline void set_rate(u32 rate) { m_rate = rate; }
+
+		// getters
+		inline u32 rate() { return m_rate; }
+
+		inline u32 devices() { return u32(m_device.size()); }
+
+		inline u64 slept() { return m_slept; }	// samples rendered with every chips sleeping
+
+		inline board_device *device(u32 index)
+		{
+			return (index < m_device.size()) ? m_device[index] : nullptr;
+		}
+
+	private:
+		u32 m_rate = 44100;					   // host sample rate
+		std::vector<board_device *> m_device;  // attached chips
+		u64 m_slept = 0;					   // samples rendered with every chips sleeping
+
+		board_trace_writer *m_trace = nullptr;	// access recorder
+		u64 m_time					= 0;		// rendered samples since trace start
+};
+
+#endif
@@ -0,0 +1,440 @@
+/*
+	License: Zlib
+	see https://gitlab.com/cam900/vgsound_emu/-/blob/main/LICENSE for more details
+
+	Copyright holder(s): cam900
+	Board devices for each sound chips
+
+	Output rate of each devices:
+
+	Chip            Output rate
+	K051649/K052539 Input clock
+	K007232         Input clock / 4
+	K053260         Input clock
+	MSM6295         Input clock / 33 / (SS ? 5 : 4)
+	X1-010          Input clock / 512
+	ES5505/ES5506   Input clock / 16 (single voice update)
+
+	Sample ROMs are not copied, memory must be alive while attached.
+
+	MSM6295 device supports NMK112 bank switching, it has 4 banks of 64KB;
+   and phrase table (0x000-0x3ff) is also paged into each banks for each 0x100
+   bytes if bit 7 of mode is set. Sample pages are mapped directly into core,
+   and paged phrase table is accessed via memory interface.
+
+	ES5505/ES5506 is updated with tick_perf, and single update is executed at
+   reset for accepting host writes immediately. ES5506 output is serial output
+   configured by W_ST, W_END and MODE registers, like as hardware.
+*/
+
+#include "board_devices.hpp"
+
+// Konami K051649/K052539 SCC
+void board_scc_device::host_w(u32 address, u32 data)
+{
+	m_core->scc_w(m_sccplus, u8(address), u8(data));
+}
+
+u32 board_scc_device::host_r(u32 address) { return m_core->scc_r(m_sccplus, u8(address)); }
+
+void board_scc_device::reset()
+{
+	board_device::reset();
+	m_core->reset();
+}
+
+void board_scc_device::serialize(serializer_t &s)
+{
+	board_device::serialize(s);
+	m_core->serialize(s);
+}
+
+void board_scc_device::run(u32 ticks, s64 &left, s64 &right)
+{
+	s64 out = 0;
+	for (u32 t = 0; t < ticks; t++)
+	{
+		m_core->tick();
+		out += m_core->out();
+	}
+	left  += out;
+	right += out;
+}
+
+bool board_scc_device::idle() { return m_core->idle(); }
+
+void board_scc_device::skip_idle(u64 ticks) { m_core->skip_idle(ticks); }
+
+// Konami K007232
+void board_k007232_device::host_w(u32 address, u32 data)
+{
+	m_core.write(bitfield<u8>(address, 0, 4), u8(data));
+}
+
+void board_k007232_device::rom_w(u8 region, const u8 *data, u32 size)
+{
+	m_core.set_rom(region & 1, data, size);
+}
+
+void board_k007232_device::control_w(u32 address, u32 data)
+{
+	switch (address)
+	{
+		case CONTROL_PAN + 0:
+		case CONTROL_PAN + 1:
+			m_core.set_pan(address - CONTROL_PAN, u8(bitfield(data, 0, 8)), u8(bitfield(data, 8, 8)));
+			break;
+		default: break;
+	}
+}
+
+void board_k007232_device::reset()
+{
+	board_device::reset();
+	m_core.reset();
+}
+
+void board_k007232_device::serialize(serializer_t &s)
+{
+	board_device::serialize(s);
+	m_core.serialize(s);
+}
+
+void board_k007232_device::run(u32 ticks, s64 &left, s64 &right)
+{
+	std::array<s32, 512> buf;
+	while (ticks > 0)
+	{
+		const u32 len = std::min<u32>(ticks, 256);
+		m_core.render_stereo(buf.data(), len);
+		for (u32 i = 0; i < len; i++)
+		{
+			left  += buf[(i << 1) + 0];
+			right += buf[(i << 1) + 1];
+		}
+		ticks -= len;
+	}
+}
+
+bool board_k007232_device::idle() { return m_core.idle(); }
+
+void board_k007232_device::skip_idle(u64 ticks) { m_core.skip_idle(ticks); }
+
+// Konami K053260
+void board_k053260_device::host_w(u32 address, u32 data)
+{
+	m_core.write(bitfield<u8>(address, 0, 6), u8(data));
+}
+
+u32 board_k053260_device::host_r(u32 address) { return m_core.read(bitfield<u8>(address, 0, 6)); }
+
+void board_k053260_device::rom_w(u8 region, const u8 *data, u32 size)
+{
+	m_intf.set_rom(data, size);
+}
+
+void board_k053260_device::reset()
+{
+	board_device::reset();
+	m_core.reset();
+}
+
+void board_k053260_device::serialize(serializer_t &s)
+{
+	board_device::serialize(s);
+	m_core.serialize(s);
+}
+
+void board_k053260_device::run(u32 ticks, s64 &left, s64 &right)
+{
+	for (u32 t = 0; t < ticks; t++)
+	{
+		m_core.tick();
+		left  += m_core.output(0);
+		right += m_core.output(1);
+	}
+}
+
+bool board_k053260_device::idle() { return m_core.idle(); }
+
+void board_k053260_device::skip_idle(u64 ticks) { m_core.skip_idle(ticks); }
+
+// OKI MSM6295
+u8 board_msm6295_device::intf_t::read_byte(u32 address)
+{
+	if (m_nmk112 == 0)
+	{
+		return m_rom.read_byte(address);
+	}
+
+	u32 bank   = bitfield(address, 16, 2);
+	u32 offset = bitfield(address, 0, 16);
+	if (bitfield(m_nmk112, 7) && (address < 0x400))
+	{  // paged phrase table
+		bank   = bitfield(address, 8, 2);
+		offset = bitfield(address, 0, 8);
+	}
+	return m_rom.read_byte((u32(m_nmk112_bank[bank]) << 16) | offset);
+}
+
+void board_msm6295_device::host_w(u32 address, u32 data)
+{
+	if (address == 0)
+	{
+		m_core.command_w(u8(data));
+	}
+}
+
+u32 board_msm6295_device::host_r(u32 address) { return m_core.busy_r(); }
+
+void board_msm6295_device::rom_w(u8 region, const u8 *data, u32 size)
+{
+	m_intf.set_rom(data, size);
+	update_bank();
+}
+
+void board_msm6295_device::reset()
+{
+	board_device::reset();
+	m_core.reset();
+	m_core.ss_w(ss());
+	m_intf.set_nmk112(0);
+	for (u8 b = 0; b < 4; b++)
+	{
+		m_intf.set_nmk112_bank(b, 0);
+	}
+	update_bank();
+}
+
+void board_msm6295_device::serialize(serializer_t &s)
+{
+	board_device::serialize(s);
+	m_core.serialize(s);
+	m_intf.serialize(s);
+	if (s.loading())
+	{
+		update_bank();
+	}
+}
+
+void board_msm6295_device::control_w(u32 address, u32 data)
+{
+	switch (address)
+	{
+		case CONTROL_CLOCK: set_clock_flags(data, flags()); break;
+		case CONTROL_SS:
+			set_clock_flags(clock(), data ? 1 : 0);
+			m_core.ss_w(ss());
+			break;
+		case CONTROL_NMK112: m_intf.set_nmk112(u8(data)); break;
+		case CONTROL_NMK112_BANK + 0:
+		case CONTROL_NMK112_BANK + 1:
+		case CONTROL_NMK112_BANK + 2:
+		case CONTROL_NMK112_BANK + 3:
+			m_intf.set_nmk112_bank(address - CONTROL_NMK112_BANK, u8(data));
+			break;
+		default: return;
+	}
+	set_rate(clock() / (33 * (ss() ? 5 : 4)));
+	update_bank();
+}
+
+// map 16KB pages into core, paged phrase table is accessed via interface
+void board_msm6295_device::update_bank()
+{
+	const rom_span_t &rom = m_intf.rom();
+	for (u8 page = 0; page < 16; page++)
+	{
+		u32 addr = u32(page) << 14;
+		if (m_intf.nmk112() != 0)
+		{
+			addr = (u32(m_intf.nmk112_bank(page >> 2)) << 16) | (u32(page & 3) << 14);
+		}
+
+		if ((page == 0) && bitfield(m_intf.nmk112(), 7))
+		{
+			m_core.set_bank(page, nullptr, 0);
+		}
+		else if (addr < rom.size())
+		{
+			m_core.set_bank(page, rom.data() + addr, std::min<u32>(0x4000, rom.size() - addr));
+		}
+		else
+		{
+			m_core.set_bank(page, nullptr, 0);
+		}
+	}
+}
+
+void board_msm6295_device::run(u32 ticks, s64 &left, s64 &right)
+{
+	std::array<s32, 256> buf;
+	s64 out = 0;
+	while (ticks > 0)
+	{
+		const u32 len = std::min<u32>(ticks, 256);
+		m_core.render(buf.data(), len);
+		for (u32 i = 0; i < len; i++)
+		{
+			out += buf[i];
+		}
+		ticks -= len;
+	}
+	left  += out;
+	right += out;
+}
+
+bool board_msm6295_device::idle() { return m_core.idle(); }
+
+// each output is 33 rounds of voice ticks
+void board_msm6295_device::skip_idle(u64 ticks)
+{
+	m_core.skip_idle(ticks * 33 * (ss() ? 5 : 4));
+}
+
+// Seta/Allumer X1-010
+void board_x1_010_device::host_w(u32 address, u32 data)
+{
+	m_core.ram_w(bitfield<u16>(address, 0, 13), u8(data));
+}
+
+u32 board_x1_010_device::host_r(u32 address) { return m_core.ram_r(bitfield<u16>(address, 0, 13)); }
+
+void board_x1_010_device::rom_w(u8 region, const u8 *data, u32 size)
+{
+	m_core.set_rom(data, size);
+}
+
+void board_x1_010_device::reset()
+{
+	board_device::reset();
+	m_core.reset();
+}
+
+void board_x1_010_device::serialize(serializer_t &s)
+{
+	board_device::serialize(s);
+	m_core.serialize(s);
+}
+
+void board_x1_010_device::run(u32 ticks, s64 &left, s64 &right)
+{
+	std::array<s32, 256> lbuf, rbuf;
+	while (ticks > 0)
+	{
+		const u32 len = std::min<u32>(ticks, 256);
+		m_core.render(lbuf.data(), rbuf.data(), len);
+		for (u32 i = 0; i < len; i++)
+		{
+			left  += lbuf[i];
+			right += rbuf[i];
+		}
+		ticks -= len;
+	}
+}
+
+bool board_x1_010_device::idle() { return m_core.idle(); }
+
+void board_x1_010_device::skip_idle(u64 ticks) { m_core.skip_idle(ticks); }
+
+// Ensoniq ES5505
+void board_es5505_device::host_w(u32 address, u32 data)
+{
+	m_core.host_w(bitfield<u8>(address, 0, 4), u16(data));
+}
+
+u32 board_es5505_device::host_r(u32 address) { return m_core.host_r(bitfield<u8>(address, 0, 4)); }
+
+void board_es5505_device::rom_w(u8 region, const u8 *data, u32 size)
+{
+	m_intf.set_rom(region, data, size);
+}
+
+void board_es5505_device::reset()
+{
+	board_device::reset();
+	m_core.reset();
+	m_core.tick_perf();	 // E clock is high after single update
+}
+
+void board_es5505_device::serialize(serializer_t &s)
+{
+	board_device::serialize(s);
+	m_core.serialize(s);
+}
+
+void board_es5505_device::run(u32 ticks, s64 &left, s64 &right)
+{
+	for (u32 t = 0; t < ticks; t++)
+	{
+		m_core.tick_perf();
+		for (u8 c = 0; c < 4; c++)
+		{
+			left  += m_core.lout(c);
+			right += m_core.rout(c);
+		}
+	}
+}
+
+bool board_es5505_device::idle() { return m_core.idle(); }
+
+void board_es5505_device::skip_idle(u64 ticks) { m_core.skip_idle(ticks); }
+
+// Ensoniq ES5506
+void board_es5506_device::host_w(u32 address, u32 data)
+{
+	m_core.host_w(bitfield<u8>(address, 0, 6), u8(data));
+}
+
+u32 board_es5506_device::host_r(u32 address) { return m_core.host_r(bitfield<u8>(address, 0, 6)); }
+
+void board_es5506_device::rom_w(u8 region, const u8 *data, u32 size)
+{
+	m_intf.set_rom(region, data, size);
+}
+
+void board_es5506_device::reset()
+{
+	board_device::reset();
+	m_core.reset();
+	m_core.tick_perf();	 // E clock is high after single update
+}
+
+void board_es5506_device::serialize(serializer_t &s)
+{
+	board_device::serialize(s);
+	m_core.serialize(s);
+}
+
+void board_es5506_device::run(u32 ticks, s64 &left, s64 &right)
+{
+	for (u32 t = 0; t < ticks; t++)
+	{
+		m_core.tick_perf();
+		for (u8 c = 0; c < 6; c++)
+		{
+			left  += m_core.lout(c);
+			right += m_core.rout(c);
+		}
+	}
+}
+
+bool board_es5506_device::idle() { return m_core.idle(); }
+
+void board_es5506_device::skip_idle(u64 ticks) { m_core.skip_idle(ticks); }
+
+// Device factory
+board_device *board_create_device(u8 kind, u32 clock, u32 flags)
+{
+	switch (kind)
+	{
+		case board_device::KIND_SCC: return new board_scc_device(clock, flags & 1);
+		case board_device::KIND_K007232: return new board_k007232_device(clock);
+		case board_device::KIND_K053260: return new board_k053260_device(clock);
+		case board_device::KIND_MSM6295: return new board_msm6295_device(clock, flags & 1);
+		case board_device::KIND_X1_010: return new board_x1_010_device(clock);
+		case board_device::KIND_ES5505: return new board_es5505_device(clock);
+		case board_device::KIND_ES5506: return new board_es5506_device(clock);
+		default: return nullptr;
+	}
+}
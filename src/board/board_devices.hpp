@@ -0,0 +1,359 @@
+/*
+	License: Zlib
+	see https://gitlab.com/cam900/vgsound_emu/-/blob/main/LICENSE for more details
+
+	Copyright holder(s): cam900
+	Board devices for each sound chips
+
+	See board_devices.cpp for more info.
+*/
+
+#ifndef _VGSOUND_EMU_SRC_BOARD_BOARD_DEVICES_HPP
+#define _VGSOUND_EMU_SRC_BOARD_BOARD_DEVICES_HPP
+
+#pragma once
+
+#include "../es550x/es5505.hpp"
+#include "../es550x/es5506.hpp"
+#include "../k007232/k007232.hpp"
+#include "../k053260/k053260.hpp"
+#include "../msm6295/msm6295.hpp"
+#include "../scc/scc.hpp"
+#include "../x1_010/x1_010.hpp"
+#include "board.hpp"
+
+// create device for chip type, nullptr if unknown
+board_device *board_create_device(u8 kind, u32 clock, u32 flags);
+
+// Konami K051649/K052539 SCC
+// address: SCC register (0x00-0xff), in SCC+ layout if SCC+ mode
+class board_scc_device : public board_device
+{
+	public:
+		// constructor
+		board_scc_device(u32 clock, bool sccplus = false)
+			: board_device("board_scc", KIND_SCC, clock, sccplus ? 1 : 0, clock, 0x2000)
+			, m_sccplus(sccplus)
+			, m_core(sccplus ? new k052539_scc_core() : new k051649_scc_core())
+		{
+		}
+
+		virtual void reset() override;
+		virtual void serialize(serializer_t &s) override;
+
+		// getters
+		inline bool sccplus() { return m_sccplus; }
+
+	protected:
+		virtual void host_w(u32 address, u32 data) override;
+		virtual u32 host_r(u32 address) override;
+		virtual void run(u32 ticks, s64 &left, s64 &right) override;
+		virtual bool idle() override;
+		virtual void skip_idle(u64 ticks) override;
+
+	private:
+		bool m_sccplus = false;			  // SCC+ (K052539) mode
+		std::unique_ptr<scc_core> m_core;  // K051649 or K052539
+};
+
+// Konami K007232
+// address: register (0x0-0xf), region: NE pin
+class board_k007232_device : public board_device
+{
+	public:
+		// constructor
+		board_k007232_device(u32 clock)
+			: board_device("board_k007232", KIND_K007232, clock, 0, clock / 4, 0x10)
+			, m_intf()
+			, m_core(m_intf)
+		{
+		}
+
+		// device settings for control
+		enum control_t : u32
+		{
+			CONTROL_PAN = 0,  // host pan for level stage, 2 entries, left | (right << 8)
+		};
+
+		virtual void reset() override;
+		virtual void serialize(serializer_t &s) override;
+
+		// host pan for level stage
+		inline void set_pan(u8 voice, u8 left, u8 right)
+		{
+			control(CONTROL_PAN + (voice & 1), left | (u32(right) << 8));
+		}
+
+	protected:
+		virtual void host_w(u32 address, u32 data) override;
+		virtual void rom_w(u8 region, const u8 *data, u32 size) override;
+		virtual void control_w(u32 address, u32 data) override;
+		virtual void run(u32 ticks, s64 &left, s64 &right) override;
+		virtual bool idle() override;
+		virtual void skip_idle(u64 ticks) override;
+
+	private:
+		k007232_intf m_intf;  // unused, ROM is accessed directly
+		k007232_core m_core;
+};
+
+// Konami K053260
+// address: register (0x00-0x3f)
+class board_k053260_device : public board_device
+{
+	private:
+		class intf_t : public k053260_intf
+		{
+			public:
+				intf_t()
+					: k053260_intf()
+					, m_rom(rom_span_t())
+				{
+				}
+
+				virtual u8 read_sample(u32 address) override { return m_rom.read_byte(address); }
+
+				inline void set_rom(const u8 *data, u32 size) { m_rom.set(data, size); }
+
+			private:
+				rom_span_t m_rom;  // sample ROM
+		};
+
+	public:
+		// constructor
+		board_k053260_device(u32 clock)
+			: board_device("board_k053260", KIND_K053260, clock, 0, clock, 0x80)
+			, m_intf()
+			, m_core(m_intf)
+		{
+		}
+
+		virtual void reset() override;
+		virtual void serialize(serializer_t &s) override;
+
+	protected:
+		virtual void host_w(u32 address, u32 data) override;
+		virtual u32 host_r(u32 address) override;
+		virtual void rom_w(u8 region, const u8 *data, u32 size) override;
+		virtual void run(u32 ticks, s64 &left, s64 &right) override;
+		virtual bool idle() override;
+		virtual void skip_idle(u64 ticks) override;
+
+	private:
+		intf_t m_intf;
+		k053260_core m_core;
+};
+
+// OKI MSM6295, with optional NMK112 bank switching
+// address: 0 (command)
+class board_msm6295_device : public board_device
+{
+	private:
+		// NMK112 banked memory, for paged phrase table
+		class intf_t : public vgsound_emu_mem_intf
+		{
+			public:
+				intf_t()
+					: vgsound_emu_mem_intf()
+					, m_rom(rom_span_t())
+					, m_nmk112(0)
+					, m_nmk112_bank{0}
+				{
+				}
+
+				virtual u8 read_byte(u32 address) override;
+
+				// setters
+				inline void set_rom(const u8 *data, u32 size) { m_rom.set(data, size); }
+
+				inline void set_nmk112(u8 mode) { m_nmk112 = mode; }
+
+				inline void set_nmk112_bank(u8 bank, u8 data) { m_nmk112_bank[bank & 3] = data; }
+
+				// getters
+				inline const rom_span_t &rom() { return m_rom; }
+
+				inline u8 nmk112() { return m_nmk112; }
+
+				inline u8 nmk112_bank(u8 bank) { return m_nmk112_bank[bank & 3]; }
+
+				void serialize(serializer_t &s)
+				{
+					s.item(m_nmk112);
+					s.item(m_nmk112_bank);
+				}
+
+			private:
+				rom_span_t m_rom;						// sample ROM
+				u8 m_nmk112						= 0;	// NMK112 mode
+				std::array<u8, 4> m_nmk112_bank = {0};	// NMK112 banks (64KB unit)
+		};
+
+	public:
+		// constructor
+		board_msm6295_device(u32 clock, bool ss = false)
+			: board_device("board_msm6295",
+						   KIND_MSM6295,
+						   clock,
+						   ss ? 1 : 0,
+						   clock / (33 * (ss ? 5 : 4)),
+						   0x800)
+			, m_intf()
+			, m_core(m_intf)
+		{
+		}
+
+		// device settings for control
+		enum control_t : u32
+		{
+			CONTROL_CLOCK = 0,	  // input clock
+			CONTROL_SS,			  // SS pin
+			CONTROL_NMK112,		  // NMK112 mode
+			CONTROL_NMK112_BANK,  // NMK112 banks, 4 entries
+		};
+
+		virtual void reset() override;
+		virtual void serialize(serializer_t &s) override;
+
+		// setters
+		inline void set_clock(u32 clock) { control(CONTROL_CLOCK, clock); }
+
+		inline void set_ss(bool ss) { control(CONTROL_SS, ss ? 1 : 0); }
+
+		inline void set_nmk112(u8 mode) { control(CONTROL_NMK112, mode); }
+
+		inline void set_nmk112_bank(u8 bank, u8 data)
+		{
+			control(CONTROL_NMK112_BANK + (bank & 3), data);
+		}
+
+		// getters
+		inline bool ss() { return flags() & 1; }
+
+	protected:
+		virtual void host_w(u32 address, u32 data) override;
+		virtual u32 host_r(u32 address) override;
+		virtual void rom_w(u8 region, const u8 *data, u32 size) override;
+		virtual void control_w(u32 address, u32 data) override;
+		virtual void run(u32 ticks, s64 &left, s64 &right) override;
+		virtual bool idle() override;
+		virtual void skip_idle(u64 ticks) override;
+
+	private:
+		void update_bank();
+
+		intf_t m_intf;
+		msm6295_core m_core;
+};
+
+// Seta/Allumer X1-010
+// address: RAM offset (0x0000-0x1fff)
+class board_x1_010_device : public board_device
+{
+	public:
+		// constructor
+		board_x1_010_device(u32 clock)
+			: board_device("board_x1_010", KIND_X1_010, clock, 0, clock / 512, 0x100)
+			, m_intf()
+			, m_core(m_intf)
+		{
+		}
+
+		virtual void reset() override;
+		virtual void serialize(serializer_t &s) override;
+
+	protected:
+		virtual void host_w(u32 address, u32 data) override;
+		virtual u32 host_r(u32 address) override;
+		virtual void rom_w(u8 region, const u8 *data, u32 size) override;
+		virtual void run(u32 ticks, s64 &left, s64 &right) override;
+		virtual bool idle() override;
+		virtual void skip_idle(u64 ticks) override;
+
+	private:
+		vgsound_emu_mem_intf m_intf;  // unused, ROM is accessed directly
+		x1_010_core m_core;
+};
+
+// ES5505/ES5506 sample memory, 16 bit little endian words for each bank
+class board_es550x_intf : public es550x_intf
+{
+	public:
+		board_es550x_intf()
+			: es550x_intf()
+			, m_rom{rom_span_t()}
+		{
+		}
+
+		virtual s16 read_sample(u8 voice, u8 bank, u32 address) override
+		{
+			const rom_span_t &rom = m_rom[bank & 3];
+			const u32 addr		  = address << 1;
+			return s16(rom.read_byte(addr) | (u16(rom.read_byte(addr + 1)) << 8));
+		}
+
+		inline void set_rom(u8 bank, const u8 *data, u32 size) { m_rom[bank & 3].set(data, size); }
+
+	private:
+		std::array<rom_span_t, 4> m_rom;  // sample ROM for each bank
+};
+
+// Ensoniq ES5505
+// address: host address (0x00-0x0f), data: 16 bit, region: bank
+class board_es5505_device : public board_device
+{
+	public:
+		// constructor
+		board_es5505_device(u32 clock)
+			: board_device("board_es5505", KIND_ES5505, clock, 0, clock / 16, 0x80)
+			, m_intf()
+			, m_core(m_intf)
+		{
+		}
+
+		virtual void reset() override;
+		virtual void serialize(serializer_t &s) override;
+
+	protected:
+		virtual void host_w(u32 address, u32 data) override;
+		virtual u32 host_r(u32 address) override;
+		virtual void rom_w(u8 region, const u8 *data, u32 size) override;
+		virtual void run(u32 ticks, s64 &left, s64 &right) override;
+		virtual bool idle() override;
+		virtual void skip_idle(u64 ticks) override;
+
+	private:
+		board_es550x_intf m_intf;
+		es5505_core m_core;
+};
+
+// Ensoniq ES5506
+// address: host address (0x00-0x3f), data: 8 bit, region: bank
+class board_es5506_device : public board_device
+{
+	public:
+		// constructor
+		board_es5506_device(u32 clock)
+			: board_device("board_es5506", KIND_ES5506, clock, 0, clock / 16, 0x10)
+			, m_intf()
+			, m_core(m_intf)
+		{
+		}
+
+		virtual void reset() override;
+		virtual void serialize(serializer_t &s) override;
+
+	protected:
+		virtual void host_w(u32 address, u32 data) override;
+		virtual u32 host_r(u32 address) override;
+		virtual void rom_w(u8 region, const u8 *data, u32 size) override;
+		virtual void run(u32 ticks, s64 &left, s64 &right) override;
+		virtual bool idle() override;
+		virtual void skip_idle(u64 ticks) override;
+
+	private:
+		board_es550x_intf m_intf;
+		es5506_core m_core;
+};
+
+#endif
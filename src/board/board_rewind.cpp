@@ -0,0 +1,244 @@
+/*
+	License: Zlib
+	see https://gitlab.com/cam900/vgsound_emu/-/blob/main/LICENSE for more details
+
+	Copyright holder(s): cam900
+	Rewind history of board
+
+	State of every attached chips is serialized for each frame, and kept in
+   history for configured length. Most of states are unchanged between frames
+   (wavetables, register pools, envelope tables), so full state is stored as
+   keyframe at each interval only, and other frames are stored as difference
+   from previous frame (XOR).
+
+	Both of keyframe and difference are run length encoded:
+
+	varint zero run length
+	varint literal length
+	...    literal bytes
+
+	Repeated until end of state, varint is unsigned LEB128.
+
+	Keyframe is also forced if state size is changed (attached chips are
+   changed). Oldest frames are discarded in group of keyframe and following
+   differences, so history can be longer than configured length until next
+   keyframe is expired.
+
+	Restore decodes nearest keyframe and applies following differences, then
+   loads state into every attached chips; output after restore is bit exact.
+   Sample memory isn't included in state, it must be unchanged or restored by
+   host. Output gain is host setting, and isn't included also.
+
+	Memory usage and cost of push is reported, for tuning interval.
+*/
+
+#include "board_rewind.hpp"
+
+#include <chrono>
+
+void board_rewind::configure(u32 length, u32 interval)
+{
+	m_length   = length;
+	m_interval = std::max<u32>(1, interval);
+	clear();
+}
+
+void board_rewind::clear()
+{
+	m_history.clear();
+	m_prev.clear();
+	m_delta		 = 0;
+	m_memory	 = 0;
+	m_last_size	 = 0;
+	m_last_time	 = 0.0;
+	m_total_time = 0.0;
+	m_pushes	 = 0;
+}
+
+void board_rewind::push()
+{
+	if (m_length == 0)
+	{
+		return;
+	}
+
+	const auto begin = std::chrono::steady_clock::now();
+
+	m_state.clear();
+	serializer_t s(m_state);
+	m_board.serialize(s);
+
+	frame_t frame;
+	frame.key = m_history.empty() || ((m_delta + 1) >= m_interval) ||
+				(m_state.size() != m_prev.size());
+	encode(m_state, frame.key ? nullptr : &m_prev);
+	frame.data.assign(m_encode.begin(), m_encode.end());
+	m_delta = frame.key ? 0 : (m_delta + 1);
+
+	m_last_size	 = u32(frame.data.size());
+	m_memory	+= m_last_size;
+	m_history.push_back(std::move(frame));
+	m_prev.swap(m_state);
+
+	// discard oldest keyframe and following differences, if rest is enough for history
+	while (m_history.size() > m_length)
+	{
+		u32 next = 1;
+		while ((next < m_history.size()) && (!m_history[next].key))
+		{
+			next++;
+		}
+		if ((m_history.size() - next) < m_length)
+		{
+			break;
+		}
+		for (u32 i = 0; i < next; i++)
+		{
+			m_memory -= m_history.front().data.size();
+			m_history.pop_front();
+		}
+	}
+
+	m_last_time = std::chrono::duration<f64>(std::chrono::steady_clock::now() - begin).count();
+	m_total_time += m_last_time;
+	m_pushes++;
+}
+
+bool board_rewind::rewind(u32 frames)
+{
+	if (frames >= m_history.size())
+	{
+		return false;
+	}
+
+	const u32 target = u32(m_history.size()) - 1 - frames;
+	u32 key			 = target;
+	while ((key > 0) && (!m_history[key].key))
+	{
+		key--;
+	}
+
+	for (u32 i = key; i <= target; i++)
+	{
+		decode(m_history[i], m_prev);
+	}
+
+	serializer_t s(m_prev.data(), u32(m_prev.size()));
+	m_board.serialize(s);
+
+	while (m_history.size() > (target + 1))
+	{
+		m_memory -= m_history.back().data.size();
+		m_history.pop_back();
+	}
+	m_delta = target - key;
+	return !s.error();
+}
+
+u32 board_rewind::keyframes() const
+{
+	u32 ret = 0;
+	for (const frame_t &elem : m_history)
+	{
+		if (elem.key)
+		{
+			ret++;
+		}
+	}
+	return ret;
+}
+
+// run length encode state, or difference from base if base isn't nullptr
+void board_rewind::encode(const std::vector<u8> &state, const std::vector<u8> *base)
+{
+	const u32 size = u32(state.size());
+	auto get	   = [&state, base](u32 pos) -> u8
+	{ return base ? (state[pos] ^ (*base)[pos]) : state[pos]; };
+
+	m_encode.clear();
+	varint(size);
+	u32 pos = 0;
+	while (pos < size)
+	{
+		const u32 zero = pos;
+		while ((pos < size) && (get(pos) == 0))
+		{
+			pos++;
+		}
+
+		// literal is ended at run of zeros longer than its header
+		const u32 literal = pos;
+		u32 run			  = 0;
+		while ((pos < size) && (run < 4))
+		{
+			run = (get(pos) == 0) ? (run + 1) : 0;
+			pos++;
+		}
+		if (run >= 4)
+		{
+			pos -= run;
+		}
+
+		varint(literal - zero);
+		varint(pos - literal);
+		for (u32 i = literal; i < pos; i++)
+		{
+			m_encode.push_back(get(i));
+		}
+	}
+}
+
+// decode keyframe into state, or apply difference into state
+void board_rewind::decode(const frame_t &frame, std::vector<u8> &state)
+{
+	const u8 *data = frame.data.data();
+	const u8 *end  = data + frame.data.size();
+	auto fetch	   = [&data, end]() -> u32
+	{
+		u32 ret = 0;
+		for (u8 shift = 0; (shift < 32) && (data < end); shift += 7)
+		{
+			const u8 byte  = *data++;
+			ret			  |= u32(byte & 0x7f) << shift;
+			if ((byte & 0x80) == 0)
+			{
+				break;
+			}
+		}
+		return ret;
+	};
+
+	const u32 size = fetch();
+	if (frame.key)
+	{
+		state.assign(size, 0);
+	}
+
+	u32 pos = 0;
+	while ((data < end) && (pos < size))
+	{
+		pos				  += fetch();
+		const u32 literal = std::min<u32>(fetch(), u32(end - data));
+		for (u32 i = 0; (i < literal) && (pos < size); i++, pos++)
+		{
+			if (frame.key)
+			{
+				state[pos] = *data++;
+			}
+			else
+			{
+				state[pos] ^= *data++;
+			}
+		}
+	}
+}
+
+void board_rewind::varint(u32 data)
+{
+	while (data >= 0x80)
+	{
+		m_encode.push_back(u8(data | 0x80));
+		data >>= 7;
+	}
+	m_encode.push_back(u8(data));
+}
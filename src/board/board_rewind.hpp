@@ -0,0 +1,107 @@
+/*
+	License: Zlib
+	see https://gitlab.com/cam900/vgsound_emu/-/blob/main/LICENSE for more details
+
+	Copyright holder(s): cam900
+	Rewind history of board
+
+	See board_rewind.cpp for more info.
+*/
+
+#ifndef _VGSOUND_EMU_SRC_BOARD_BOARD_REWIND_HPP
+#define _VGSOUND_EMU_SRC_BOARD_BOARD_REWIND_HPP
+
+#pragma once
+
+#include "../core/util.hpp"
+#include "board.hpp"
+
+#include <deque>
+
+// Rewind history, snapshot of every attached chips is pushed for each frame
+class board_rewind : public vgsound_emu_core
+{
+	private:
+		// snapshot of single frame, keyframe or delta from previous frame
+		struct frame_t
+		{
+				bool key = false;	   // keyframe
+				std::vector<u8> data;  // run length encoded state
+		};
+
+	public:
+		// constructor
+		board_rewind(board_core &board)
+			: vgsound_emu_core("board_rewind")
+			, m_board(board)
+			, m_history()
+			, m_prev()
+			, m_state()
+			, m_encode()
+			, m_length(0)
+			, m_interval(1)
+			, m_delta(0)
+			, m_memory(0)
+			, m_last_size(0)
+			, m_last_time(0.0)
+			, m_total_time(0.0)
+			, m_pushes(0)
+		{
+		}
+
+		// history length in frames (seconds * frame rate) and keyframe interval in frames
+		// history is cleared
+		void configure(u32 length, u32 interval = 60);
+		void clear();
+
+		// push current state of board as newest frame, oldest frames are discarded
+		void push();
+
+		// restore state of (frames) before newest frame, newer frames are discarded
+		// returns false if it's out of history
+		bool rewind(u32 frames = 0);
+
+		// getters
+		inline u32 frames() const { return u32(m_history.size()); }  // stored frames
+
+		inline u32 length() const { return m_length; }
+
+		inline u32 interval() const { return m_interval; }
+
+		inline u64 memory() const { return m_memory; }  // encoded bytes in history
+
+		inline u32 state_size() const { return u32(m_prev.size()); }  // raw bytes of snapshot
+
+		inline u32 last_size() const { return m_last_size; }  // encoded bytes of last push
+
+		inline f64 last_time() const { return m_last_time; }  // seconds of last push
+
+		inline f64 average_time() const  // average seconds of push
+		{
+			return m_pushes ? (m_total_time / f64(m_pushes)) : 0.0;
+		}
+
+		u32 keyframes() const;
+
+	private:
+		void encode(const std::vector<u8> &state, const std::vector<u8> *base);
+		void decode(const frame_t &frame, std::vector<u8> &state);
+		void varint(u32 data);
+
+		board_core &m_board;			// target board
+		std::deque<frame_t> m_history;	// frames, oldest first
+		std::vector<u8> m_prev;			// state of newest frame
+		std::vector<u8> m_state;		// state of current push
+		std::vector<u8> m_encode;		// encode buffer
+
+		u32 m_length	 = 0;	 // history length
+		u32 m_interval	 = 1;	 // keyframe interval
+		u32 m_delta		 = 0;	 // frames since last keyframe
+		u64 m_memory	 = 0;	 // encoded bytes in history
+		u32 m_last_size	 = 0;	 // encoded bytes of last push
+		f64 m_last_time	 = 0.0;	 // seconds of last push
+		f64 m_total_time = 0.0;	 // total seconds of push
+		u64 m_pushes	 = 0;	 // push count
+};
+
+#endif
@@ -0,0 +1,393 @@
+/*
+	License: Zlib
+	see https://gitlab.com/cam900/vgsound_emu/-/blob/main/LICENSE for more details
+
+	Copyright holder(s): cam900
+	Register access trace of board, recorder and replayer
+
+	Every host accesses of board devices (write, read, sample memory and
+   device settings, including gain and K007232 pan) are recorded with time in
+   host samples, replayer recreates chips from trace and feeds accesses back
+   at same sample, so output is bit exact to recorded session. Replayer
+   doesn't wait for real time, it's useful for benchmarking with real world
+   register traffic and reproducing issues offline.
+
+	Only chips with board device (board_devices.hpp) can be traced; accesses
+   of N163, ES5504, VRC VI and K005289 cores aren't recorded, because these
+   cores have no board device yet (VRC VI and K005289 cores also have no save
+   state, it's required for rewind of board).
+
+	Recording should be started before reset of board, chip states before
+   start of trace are not recorded.
+
+	Trace format (all integers are little endian, varint is unsigned LEB128):
+
+	Offset Size   Description
+	0      4      "VGTR"
+	4      1      Version (1)
+	5      varint Host sample rate
+	...    ...    Events
+
+	Event:
+	varint (time delta << 3) | type
+	u8     device index
+	...    payload of each type
+
+	Type Payload
+	0    u8 kind, varint clock, varint flags (attach device, index is
+	       sequential)
+	1    none (reset)
+	2    varint address, varint data (write)
+	3    varint address, varint data (read, data is read result)
+	4    u8 region, varint size, varint offset, varint length, data
+	       (sample memory, only changed range since last update of same
+	       region is stored, new area is zero filled)
+	5    varint address, varint data (device setting)
+	6    none (end of trace, device index is 0)
+*/
+
+#include "board_trace.hpp"
+#include "board_devices.hpp"
+
+#include <cstdio>
+#include <cstring>
+
+// Recorder
+void board_trace_writer::start(u32 rate)
+{
+	m_data.clear();
+	m_rom.clear();
+	m_time	 = 0;
+	m_events = 0;
+	m_data.insert(m_data.end(), {'V', 'G', 'T', 'R', 1});
+	varint(rate);
+}
+
+void board_trace_writer::device(u64 time, u8 index, u8 kind, u32 clock, u32 flags)
+{
+	event(time, EVENT_DEVICE, index);
+	m_data.push_back(kind);
+	varint(clock);
+	varint(flags);
+}
+
+void board_trace_writer::reset(u64 time, u8 index) { event(time, EVENT_RESET, index); }
+
+void board_trace_writer::write(u64 time, u8 index, u32 address, u32 data)
+{
+	event(time, EVENT_WRITE, index);
+	varint(address);
+	varint(data);
+}
+
+void board_trace_writer::read(u64 time, u8 index, u32 address, u32 data)
+{
+	event(time, EVENT_READ, index);
+	varint(address);
+	varint(data);
+}
+
+void board_trace_writer::rom(u64 time, u8 index, u8 region, const u8 *data, u32 size)
+{
+	if (data == nullptr)
+	{
+		size = 0;
+	}
+
+	// store changed range only, sample memory is usually updated in blocks
+	// area outside of last update is compared with zero, as same as replayer
+	std::vector<u8> &prev = m_rom[(u32(index) << 8) | region];
+	auto last			  = [&prev](u32 offset) -> u8
+	{ return (offset < prev.size()) ? prev[offset] : 0; };
+	u32 begin = 0;
+	while ((begin < size) && (last(begin) == data[begin]))
+	{
+		begin++;
+	}
+	u32 end = size;
+	while ((end > begin) && (last(end - 1) == data[end - 1]))
+	{
+		end--;
+	}
+
+	event(time, EVENT_ROM, index);
+	m_data.push_back(region);
+	varint(size);
+	varint(begin);
+	varint(end - begin);
+	m_data.insert(m_data.end(), data + begin, data + end);
+	prev.assign(data, data + size);
+}
+
+void board_trace_writer::control(u64 time, u8 index, u32 address, u32 data)
+{
+	event(time, EVENT_CONTROL, index);
+	varint(address);
+	varint(data);
+}
+
+void board_trace_writer::sync(u64 time) { event(time, EVENT_SYNC, 0); }
+
+bool board_trace_writer::save(const std::string &path)
+{
+	std::FILE *file = std::fopen(path.c_str(), "wb");
+	if (file == nullptr)
+	{
+		return false;
+	}
+	const bool ret = std::fwrite(m_data.data(), 1, m_data.size(), file) == m_data.size();
+	return (std::fclose(file) == 0) && ret;
+}
+
+void board_trace_writer::event(u64 time, u8 type, u8 index)
+{
+	const u64 delta = (time > m_time) ? (time - m_time) : 0;
+	m_time			= std::max(m_time, time);
+	varint((delta << 3) | type);
+	m_data.push_back(index);
+	m_events++;
+}
+
+void board_trace_writer::varint(u64 data)
+{
+	while (data >= 0x80)
+	{
+		m_data.push_back(u8(data | 0x80));
+		data >>= 7;
+	}
+	m_data.push_back(u8(data));
+}
+
+// Replayer
+bool board_trace_player::open(const u8 *data, u32 size)
+{
+	close();
+	if ((data == nullptr) || (size < 6) || (std::memcmp(data, "VGTR", 4) != 0) || (data[4] != 1))
+	{
+		return false;
+	}
+
+	m_data = data;
+	m_size = size;
+	m_pos  = 5;
+	m_board.set_rate(u32(varint()));
+	m_start = m_pos;
+	if (m_board.rate() == 0)
+	{
+		close();
+		return false;
+	}
+	reset();
+	return true;
+}
+
+bool board_trace_player::load(const std::string &path)
+{
+	close();
+	std::FILE *file = std::fopen(path.c_str(), "rb");
+	if (file == nullptr)
+	{
+		return false;
+	}
+
+	std::vector<u8> buf;
+	std::array<u8, 0x10000> block;
+	size_t len;
+	while ((len = std::fread(block.data(), 1, block.size(), file)) > 0)
+	{
+		buf.insert(buf.end(), block.begin(), block.begin() + len);
+	}
+	std::fclose(file);
+
+	m_file.swap(buf);
+	return open(m_file.data(), u32(m_file.size()));
+}
+
+void board_trace_player::close()
+{
+	m_board.detach_all();
+	m_device.clear();
+	m_rom.clear();
+	m_data		 = nullptr;
+	m_size		 = 0;
+	m_start		 = 0;
+	m_pos		 = 0;
+	m_next_time	 = 0;
+	m_out_time	 = 0;
+	m_events	 = 0;
+	m_mismatch	 = 0;
+	m_ended		 = true;
+}
+
+void board_trace_player::reset()
+{
+	if (m_data == nullptr)
+	{
+		return;
+	}
+
+	m_board.detach_all();
+	m_device.clear();
+	m_rom.clear();
+	m_pos		= m_start;
+	m_next_time = 0;
+	m_out_time	= 0;
+	m_events	= 0;
+	m_mismatch	= 0;
+	m_ended		= false;
+	next();
+}
+
+u32 board_trace_player::render(s32 *out, u32 samples)
+{
+	u32 done = 0;
+	while (done < samples)
+	{
+		if (m_next_time <= m_out_time)
+		{
+			if (!execute())
+			{
+				break;
+			}
+			continue;
+		}
+
+		// advance every chips until next event
+		const u32 len = u32(std::min<u64>(m_next_time - m_out_time, samples - done));
+		m_board.render(out + (done << 1), len);
+		m_out_time += len;
+		done	   += len;
+	}
+
+	if (done < samples)
+	{
+		std::fill_n(out + (done << 1), (samples - done) << 1, 0);
+	}
+	return done;
+}
+
+// execute pending events at current time, returns false if trace is ended
+bool board_trace_player::execute()
+{
+	while ((!m_ended) && (m_next_time <= m_out_time))
+	{
+		board_device *dev =
+		  (m_next_index < m_device.size()) ? m_device[m_next_index].get() : nullptr;
+		switch (m_next_type)
+		{
+			case board_trace_writer::EVENT_DEVICE:
+			{
+				const u8 kind	= fetch();
+				const u32 clock = u32(varint());
+				const u32 flags = u32(varint());
+				if (m_next_index == m_device.size())
+				{
+					m_device.emplace_back(board_create_device(kind, clock, flags));
+					if (m_device.back() == nullptr)
+					{
+						m_ended = true;	 // unknown chip
+						break;
+					}
+					m_board.attach(*m_device.back());
+				}
+				break;
+			}
+			case board_trace_writer::EVENT_RESET:
+				if (dev != nullptr)
+				{
+					dev->reset();
+				}
+				break;
+			case board_trace_writer::EVENT_WRITE:
+			{
+				const u32 address = u32(varint());
+				const u32 data	  = u32(varint());
+				if (dev != nullptr)
+				{
+					dev->write(address, data);
+				}
+				break;
+			}
+			case board_trace_writer::EVENT_READ:
+			{
+				const u32 address = u32(varint());
+				const u32 data	  = u32(varint());
+				if ((dev != nullptr) && (dev->read(address) != data))
+				{
+					m_mismatch++;
+				}
+				break;
+			}
+			case board_trace_writer::EVENT_ROM:
+			{
+				const u8 region	 = fetch();
+				const u32 size	 = u32(varint());
+				const u32 offset = u32(varint());
+				const u32 length = u32(varint());
+				if (((u64(offset) + length) > size) || ((u64(m_pos) + length) > m_size))
+				{
+					m_ended = true;	 // broken trace
+					break;
+				}
+				std::vector<u8> &rom = m_rom[(u32(m_next_index) << 8) | region];
+				rom.resize(size, 0);
+				std::copy_n(m_data + m_pos, length, rom.data() + offset);
+				m_pos += length;
+				if (dev != nullptr)
+				{
+					dev->set_rom(region, rom.data(), size);
+				}
+				break;
+			}
+			case board_trace_writer::EVENT_CONTROL:
+			{
+				const u32 address = u32(varint());
+				const u32 data	  = u32(varint());
+				if (dev != nullptr)
+				{
+					dev->control(address, data);
+				}
+				break;
+			}
+			case board_trace_writer::EVENT_SYNC: break;
+			default: m_ended = true; break;
+		}
+
+		if (!m_ended)
+		{
+			m_events++;
+			next();
+		}
+	}
+	return !m_ended;
+}
+
+// decode header of next event
+void board_trace_player::next()
+{
+	if (m_pos >= m_size)
+	{
+		m_ended = true;
+		return;
+	}
+
+	const u64 head = varint();
+	m_next_type	   = u8(head & 7);
+	m_next_index   = fetch();
+	m_next_time	  += head >> 3;
+}
+
+u64 board_trace_player::varint()
+{
+	u64 ret = 0;
+	for (u8 shift = 0; (shift < 64) && (m_pos < m_size); shift += 7)
+	{
+		const u8 data  = m_data[m_pos++];
+		ret			  |= u64(data & 0x7f) << shift;
+		if ((data & 0x80) == 0)
+		{
+			break;
+		}
+	}
+	return ret;
+}
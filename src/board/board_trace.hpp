@@ -0,0 +1,153 @@
+/*
+	License: Zlib
+	see https://gitlab.com/cam900/vgsound_emu/-/blob/main/LICENSE for more details
+
+	Copyright holder(s): cam900
+	Register access trace of board, recorder and replayer
+
+	See board_trace.cpp for more info.
+*/
+
+#ifndef _VGSOUND_EMU_SRC_BOARD_BOARD_TRACE_HPP
+#define _VGSOUND_EMU_SRC_BOARD_BOARD_TRACE_HPP
+
+#pragma once
+
+#include "../core/util.hpp"
+#include "board.hpp"
+
+#include <map>
+
+// Trace recorder, attached into board with board_core::set_trace
+class board_trace_writer
+{
+	public:
+		// event types
+		enum event_t : u8
+		{
+			EVENT_DEVICE = 0,  // attach device: kind, clock, flags
+			EVENT_RESET,	   // reset device
+			EVENT_WRITE,	   // host write: address, data
+			EVENT_READ,		   // host read: address, read data
+			EVENT_ROM,		   // sample memory: region, size, changed range
+			EVENT_CONTROL,	   // device setting: address, data
+			EVENT_SYNC,		   // no access, end of trace
+			EVENT_COUNT
+		};
+
+		board_trace_writer()
+			: m_data()
+			, m_rom()
+			, m_time(0)
+			, m_events(0)
+		{
+		}
+
+		// clear and start new trace, rate is host sample rate of board
+		void start(u32 rate);
+
+		// events, time is host samples since start of trace
+		void device(u64 time, u8 index, u8 kind, u32 clock, u32 flags);
+		void reset(u64 time, u8 index);
+		void write(u64 time, u8 index, u32 address, u32 data);
+		void read(u64 time, u8 index, u32 address, u32 data);
+		void rom(u64 time, u8 index, u8 region, const u8 *data, u32 size);
+		void control(u64 time, u8 index, u32 address, u32 data);
+		void sync(u64 time);
+
+		// save trace into file
+		bool save(const std::string &path);
+
+		// getters
+		inline const std::vector<u8> &data() { return m_data; }
+
+		inline u64 events() { return m_events; }
+
+	private:
+		void event(u64 time, u8 type, u8 index);
+		void varint(u64 data);
+
+		std::vector<u8> m_data;				   // encoded trace
+		std::map<u32, std::vector<u8>> m_rom;  // last sample memory of each device and region
+		u64 m_time	 = 0;					   // time of last event
+		u64 m_events = 0;					   // recorded events
+};
+
+// Trace replayer, chips are created from trace and advanced at maximum speed
+class board_trace_player : public vgsound_emu_core
+{
+	public:
+		// constructor
+		board_trace_player()
+			: vgsound_emu_core("board_trace_player")
+			, m_board()
+			, m_device()
+			, m_rom()
+			, m_file()
+			, m_data(nullptr)
+			, m_size(0)
+			, m_start(0)
+			, m_pos(0)
+			, m_next_type(0)
+			, m_next_index(0)
+			, m_next_time(0)
+			, m_out_time(0)
+			, m_events(0)
+			, m_mismatch(0)
+			, m_ended(true)
+		{
+		}
+
+		// open trace in memory, data must be alive while playing
+		bool open(const u8 *data, u32 size);
+
+		// load trace from file
+		bool load(const std::string &path);
+
+		void close();
+
+		// restart from beginning, chips are recreated
+		void reset();
+
+		// render interleaved stereo output, returns rendered samples
+		// rest of buffer is cleared if trace is ended
+		u32 render(s32 *out, u32 samples);
+
+		// getters
+		inline bool ended() { return m_ended; }
+
+		inline u32 rate() { return m_board.rate(); }
+
+		inline u64 events() { return m_events; }  // executed events
+
+		inline u64 mismatch() { return m_mismatch; }  // host reads different from trace
+
+		inline board_core &board() { return m_board; }
+
+	private:
+		bool execute();
+		void next();
+		u64 varint();
+
+		inline u8 fetch() { return (m_pos < m_size) ? m_data[m_pos++] : 0; }
+
+		board_core m_board;									  // replayed chips
+		std::vector<std::unique_ptr<board_device>> m_device;  // chips created from trace
+		std::map<u32, std::vector<u8>> m_rom;				  // sample memory for each chip
+		std::vector<u8> m_file;								  // trace loaded from file
+
+		const u8 *m_data = nullptr;	 // trace data
+		u32 m_size		 = 0;		 // trace size
+		u32 m_start		 = 0;		 // first event offset
+		u32 m_pos		 = 0;		 // read position
+
+		u8 m_next_type	 = 0;	  // type of pending event
+		u8 m_next_index	 = 0;	  // device index of pending event
+		u64 m_next_time	 = 0;	  // time of pending event
+		u64 m_out_time	 = 0;	  // rendered samples
+		u64 m_events	 = 0;	  // executed events
+		u64 m_mismatch	 = 0;	  // mismatched reads
+		bool m_ended	 = true;  // end of trace
+};
+
+#endif
@@ -0,0 +1,164 @@
+/*
+	License: Zlib
+	see https://gitlab.com/cam900/vgsound_emu/-/blob/main/LICENSE for more details
+
+	Copyright holder(s): cam900
+	Output format conversion for vgsound_emu
+
+	Converts native integer outputs of cores into f32 or s16 samples, with
+   planar or interleaved layout. Native output width of each cores is in
+   output_bits_t.
+
+	f32 output is scaled by 1 / full scale, s16 output is shifted into 16 bit
+   and clamped; mixed outputs can exceed full scale of single channel.
+
+	Loops are kept simple (single multiply or shift and clamp for each sample,
+   no branches inside loop) for auto vectorization of compilers; stereo is
+   handled separately from other channel counts, because fixed stride is
+   vectorized better than variable stride. Vectorization needs -O3 (or
+   -ftree-vectorize) for GCC before 12.
+*/
+
+#include "convert.hpp"
+
+namespace
+{
+	inline f32 scale_f32(u8 bits) { return 1.0f / f32(u64(1) << (std::max<u8>(bits, 1) - 1)); }
+
+	// s16 conversion is (in * mul) >> shift
+	inline s32 mul_s16(u8 bits) { return (bits < 16) ? (1 << (16 - bits)) : 1; }
+
+	inline u8 shift_s16(u8 bits) { return (bits > 16) ? (bits - 16) : 0; }
+
+	inline s16 clamp_s16(s32 in) { return s16(std::min<s32>(std::max<s32>(in, -0x8000), 0x7fff)); }
+
+	template<typename T>
+	void convert_f32_loop(const T *in, f32 *out, u32 samples, f32 scale)
+	{
+		for (u32 i = 0; i < samples; i++)
+		{
+			out[i] = f32(in[i]) * scale;
+		}
+	}
+
+	template<typename T>
+	void convert_s16_loop(const T *in, s16 *out, u32 samples, s32 mul, u8 shift)
+	{
+		for (u32 i = 0; i < samples; i++)
+		{
+			out[i] = clamp_s16((s32(in[i]) * mul) >> shift);
+		}
+	}
+
+	template<typename T>
+	void interleave_f32_loop(const T *const *in, u32 channels, f32 *out, u32 samples, f32 scale)
+	{
+		if ((channels == 2) && (in[0] != nullptr) && (in[1] != nullptr))
+		{
+			const T *left  = in[0];
+			const T *right = in[1];
+			for (u32 i = 0; i < samples; i++, out += 2)
+			{
+				out[0] = f32(left[i]) * scale;
+				out[1] = f32(right[i]) * scale;
+			}
+			return;
+		}
+
+		for (u32 c = 0; c < channels; c++)
+		{
+			const T *src = in[c];
+			f32 *dst	 = out + c;
+			if (src == nullptr)
+			{
+				for (u32 i = 0; i < samples; i++, dst += channels)
+				{
+					*dst = 0.0f;
+				}
+				continue;
+			}
+			for (u32 i = 0; i < samples; i++, dst += channels)
+			{
+				*dst = f32(src[i]) * scale;
+			}
+		}
+	}
+
+	template<typename T>
+	void interleave_s16_loop(
+	  const T *const *in, u32 channels, s16 *out, u32 samples, s32 mul, u8 shift)
+	{
+		if ((channels == 2) && (in[0] != nullptr) && (in[1] != nullptr))
+		{
+			const T *left  = in[0];
+			const T *right = in[1];
+			for (u32 i = 0; i < samples; i++, out += 2)
+			{
+				out[0] = clamp_s16((s32(left[i]) * mul) >> shift);
+				out[1] = clamp_s16((s32(right[i]) * mul) >> shift);
+			}
+			return;
+		}
+
+		for (u32 c = 0; c < channels; c++)
+		{
+			const T *src = in[c];
+			s16 *dst	 = out + c;
+			if (src == nullptr)
+			{
+				for (u32 i = 0; i < samples; i++, dst += channels)
+				{
+					*dst = 0;
+				}
+				continue;
+			}
+			for (u32 i = 0; i < samples; i++, dst += channels)
+			{
+				*dst = clamp_s16((s32(src[i]) * mul) >> shift);
+			}
+		}
+	}
+}  // namespace
+
+namespace vgsound_emu
+{
+	void convert_f32(const s32 *in, f32 *out, u32 samples, u8 bits)
+	{
+		convert_f32_loop(in, out, samples, scale_f32(bits));
+	}
+
+	void convert_f32(const s16 *in, f32 *out, u32 samples, u8 bits)
+	{
+		convert_f32_loop(in, out, samples, scale_f32(bits));
+	}
+
+	void convert_s16(const s32 *in, s16 *out, u32 samples, u8 bits)
+	{
+		convert_s16_loop(in, out, samples, mul_s16(bits), shift_s16(bits));
+	}
+
+	void convert_s16(const s16 *in, s16 *out, u32 samples, u8 bits)
+	{
+		convert_s16_loop(in, out, samples, mul_s16(bits), shift_s16(bits));
+	}
+
+	void interleave_f32(const s32 *const *in, u32 channels, f32 *out, u32 samples, u8 bits)
+	{
+		interleave_f32_loop(in, channels, out, samples, scale_f32(bits));
+	}
+
+	void interleave_f32(const s16 *const *in, u32 channels, f32 *out, u32 samples, u8 bits)
+	{
+		interleave_f32_loop(in, channels, out, samples, scale_f32(bits));
+	}
+
+	void interleave_s16(const s32 *const *in, u32 channels, s16 *out, u32 samples, u8 bits)
+	{
+		interleave_s16_loop(in, channels, out, samples, mul_s16(bits), shift_s16(bits));
+	}
+
+	void interleave_s16(const s16 *const *in, u32 channels, s16 *out, u32 samples, u8 bits)
+	{
+		interleave_s16_loop(in, channels, out, samples, mul_s16(bits), shift_s16(bits));
+	}
+};	// namespace vgsound_emu
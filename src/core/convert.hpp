@@ -0,0 +1,47 @@
+/*
+	License: Zlib
+	see https://gitlab.com/cam900/vgsound_emu/-/blob/main/LICENSE for more details
+
+	Copyright holder(s): cam900
+	Output format conversion for vgsound_emu
+
+	See convert.cpp for more info.
+*/
+
+#ifndef _VGSOUND_EMU_SRC_CORE_CONVERT_HPP
+#define _VGSOUND_EMU_SRC_CORE_CONVERT_HPP
+
+#pragma once
+
+#include "util.hpp"
+
+namespace vgsound_emu
+{
+	// Native output width of cores including sign bit, full scale is 1 << (bits - 1)
+	enum output_bits_t : u8
+	{
+		OUTPUT_BITS_ES5504	  = 13,	 // 16 mono channels (out)
+		OUTPUT_BITS_ES5505	  = 16,	 // 4 stereo channels (lout, rout)
+		OUTPUT_BITS_ES5506	  = 20,	 // 6 stereo channels (lout, rout)
+		OUTPUT_BITS_SCC		  = 11,	 // DA0...DA10 pin
+		OUTPUT_BITS_N163	  = 8,	 // 4 bit waveform * 4 bit volume, in s16 (out, render)
+		OUTPUT_BITS_N163_HOST = 16,	 // above in 8 bit fraction, host rate render
+		OUTPUT_BITS_MSM6295	  = 12,	 // 12 bit DAC
+		OUTPUT_BITS_BOARD	  = 16,	 // board mixer, gain is normalized into 16 bit
+	};
+
+	// convert buffer, it can be planar channel or interleaved buffer
+	// f32 output is normalized into -1.0...1.0, s16 output is clamped
+	void convert_f32(const s32 *in, f32 *out, u32 samples, u8 bits);
+	void convert_f32(const s16 *in, f32 *out, u32 samples, u8 bits);
+	void convert_s16(const s32 *in, s16 *out, u32 samples, u8 bits);
+	void convert_s16(const s16 *in, s16 *out, u32 samples, u8 bits);
+
+	// interleave planar channel buffers into single buffer, null channel is silence
+	void interleave_f32(const s32 *const *in, u32 channels, f32 *out, u32 samples, u8 bits);
+	void interleave_f32(const s16 *const *in, u32 channels, f32 *out, u32 samples, u8 bits);
+	void interleave_s16(const s32 *const *in, u32 channels, s16 *out, u32 samples, u8 bits);
+	void interleave_s16(const s16 *const *in, u32 channels, s16 *out, u32 samples, u8 bits);
+};	// namespace vgsound_emu
+
+#endif
@@ -0,0 +1,220 @@
+/*
+	License: Zlib
+	see https://gitlab.com/cam900/vgsound_emu/-/blob/main/LICENSE for more details
+
+	Copyright holder(s): cam900
+	Memory mapped ROM file provider
+
+	Sample ROMs are mapped read-only instead of copied into memory, so large
+   sample libraries (ES5506 has 4 banks up to 2M words each) are loaded
+   lazily by OS and shared with every core instances and processes using same file.
+
+	Mappings are cached by path, opening same file again returns same mapping
+   while any reference is alive.
+
+	POSIX (mmap, madvise) and Win32 (CreateFileMapping, MapViewOfFile) are
+   supported, access pattern hint is ignored on Win32.
+*/
+
+#include "mmap.hpp"
+
+#include <map>
+#include <mutex>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// cache of opened mappings, for sharing between instances
+static std::mutex s_cache_mutex;
+static std::map<std::string, std::weak_ptr<void>> s_cache;
+
+bool vgsound_emu_mmap::open(const std::string &path, advice_t advice)
+{
+	close();
+	{
+		std::lock_guard<std::mutex> lock(s_cache_mutex);
+		// drop entries of mappings already released by every instance
+		for (auto it = s_cache.begin(); it != s_cache.end();)
+		{
+			if (it->second.expired())
+			{
+				it = s_cache.erase(it);
+			}
+			else
+			{
+				++it;
+			}
+		}
+		std::shared_ptr<void> cached = s_cache[path].lock();
+		if (cached != nullptr)
+		{
+			m_map = std::static_pointer_cast<mapping_t>(cached);
+		}
+		else
+		{
+			std::shared_ptr<mapping_t> map = std::make_shared<mapping_t>();
+			if (!map->map(path))
+			{
+				s_cache.erase(path);
+				return false;
+			}
+			s_cache[path] = map;
+			m_map		  = map;
+		}
+	}
+
+	if (advice != ADVICE_NORMAL)
+	{
+		advise(advice);
+	}
+	return true;
+}
+
+void vgsound_emu_mmap::close() { m_map.reset(); }
+
+void vgsound_emu_mmap::advise(advice_t advice, u64 offset, u64 length)
+{
+	if (valid() && (offset < size()))
+	{
+		if ((length == 0) || (length > (size() - offset)))
+		{
+			length = size() - offset;
+		}
+		m_map->advise(advice, offset, length);
+	}
+}
+
+rom_span_t vgsound_emu_mmap::span(u64 offset, u32 size) const
+{
+	if ((!valid()) || (offset >= this->size()))
+	{
+		return rom_span_t();
+	}
+
+	return rom_span_t(data() + offset, u32(std::min<u64>(size, this->size() - offset)));
+}
+
+#if defined(_WIN32)
+
+bool vgsound_emu_mmap::mapping_t::map(const std::string &path)
+{
+	HANDLE file = CreateFileA(path.c_str(),
+							  GENERIC_READ,
+							  FILE_SHARE_READ,
+							  nullptr,
+							  OPEN_EXISTING,
+							  FILE_ATTRIBUTE_NORMAL,
+							  nullptr);
+	if (file == INVALID_HANDLE_VALUE)
+	{
+		return false;
+	}
+
+	LARGE_INTEGER size;
+	if ((!GetFileSizeEx(file, &size)) || (size.QuadPart == 0))
+	{
+		CloseHandle(file);
+		return false;
+	}
+
+	HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	CloseHandle(file);
+	if (mapping == nullptr)
+	{
+		return false;
+	}
+
+	// view keeps reference of mapping object
+	void *view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	CloseHandle(mapping);
+	if (view == nullptr)
+	{
+		return false;
+	}
+
+	m_data = reinterpret_cast<const u8 *>(view);
+	m_size = u64(size.QuadPart);
+	return true;
+}
+
+void vgsound_emu_mmap::mapping_t::unmap()
+{
+	if (m_data != nullptr)
+	{
+		UnmapViewOfFile(m_data);
+		m_data = nullptr;
+		m_size = 0;
+	}
+}
+
+void vgsound_emu_mmap::mapping_t::advise(advice_t advice, u64 offset, u64 length) {}
+
+#else
+
+bool vgsound_emu_mmap::mapping_t::map(const std::string &path)
+{
+	const int fd = ::open(path.c_str(), O_RDONLY);
+	if (fd < 0)
+	{
+		return false;
+	}
+
+	struct stat st;
+	if ((fstat(fd, &st) != 0) || (st.st_size <= 0))
+	{
+		::close(fd);
+		return false;
+	}
+
+	// mapping keeps reference of file
+	void *view = mmap(nullptr, size_t(st.st_size), PROT_READ, MAP_SHARED, fd, 0);
+	::close(fd);
+	if (view == MAP_FAILED)
+	{
+		return false;
+	}
+
+	m_data = reinterpret_cast<const u8 *>(view);
+	m_size = u64(st.st_size);
+	return true;
+}
+
+void vgsound_emu_mmap::mapping_t::unmap()
+{
+	if (m_data != nullptr)
+	{
+		munmap(const_cast<u8 *>(m_data), size_t(m_size));
+		m_data = nullptr;
+		m_size = 0;
+	}
+}
+
+void vgsound_emu_mmap::mapping_t::advise(advice_t advice, u64 offset, u64 length)
+{
+	if (m_data == nullptr)
+	{
+		return;
+	}
+
+	// madvise needs page aligned address
+	const u64 page	= u64(sysconf(_SC_PAGESIZE));
+	const u64 align = offset % page;
+	int flag		= MADV_NORMAL;
+	switch (advice)
+	{
+		case ADVICE_SEQUENTIAL: flag = MADV_SEQUENTIAL; break;
+		case ADVICE_RANDOM: flag = MADV_RANDOM; break;
+		case ADVICE_WILLNEED: flag = MADV_WILLNEED; break;
+		default: break;
+	}
+	madvise(const_cast<u8 *>(m_data + offset - align), size_t(length + align), flag);
+}
+
+#endif
@@ -0,0 +1,85 @@
+/*
+	License: Zlib
+	see https://gitlab.com/cam900/vgsound_emu/-/blob/main/LICENSE for more details
+
+	Copyright holder(s): cam900
+	Memory mapped ROM file provider
+*/
+
+#ifndef _VGSOUND_EMU_SRC_CORE_MMAP_MMAP_HPP
+#define _VGSOUND_EMU_SRC_CORE_MMAP_MMAP_HPP
+
+#pragma once
+
+#include "../util.hpp"
+
+// Read-only memory mapped file, mapping is shared between copies of this class
+// and opening same file again, pages are shared between processes by OS
+class vgsound_emu_mmap
+{
+	public:
+		// access pattern hint
+		enum advice_t : u8
+		{
+			ADVICE_NORMAL = 0,
+			ADVICE_SEQUENTIAL,
+			ADVICE_RANDOM,
+			ADVICE_WILLNEED
+		};
+
+	private:
+		// platform specific mapping, unmapped when last reference is released
+		class mapping_t
+		{
+			public:
+				mapping_t()
+					: m_data(nullptr)
+					, m_size(0)
+				{
+				}
+
+				~mapping_t() { unmap(); }
+
+				bool map(const std::string &path);
+				void unmap();
+				void advise(advice_t advice, u64 offset, u64 length);
+
+				// getters
+				inline const u8 *data() const { return m_data; }
+
+				inline u64 size() const { return m_size; }
+
+			private:
+				const u8 *m_data = nullptr;	 // mapped memory
+				u64 m_size		 = 0;		 // mapped size
+		};
+
+	public:
+		// constructor
+		vgsound_emu_mmap()
+			: m_map(nullptr)
+		{
+		}
+
+		// accessors
+		bool open(const std::string &path, advice_t advice = ADVICE_NORMAL);
+		void close();
+
+		// access pattern hint for whole or part of file
+		void advise(advice_t advice, u64 offset = 0, u64 length = 0);
+
+		// getters
+		inline bool valid() const { return (m_map != nullptr) && (m_map->data() != nullptr); }
+
+		inline const u8 *data() const { return valid() ? m_map->data() : nullptr; }
+
+		inline u64 size() const { return valid() ? m_map->size() : 0; }
+
+		// raw span for direct access, clipped with file size
+		rom_span_t span(u64 offset = 0, u32 size = ~0) const;
+
+	private:
+		std::shared_ptr<mapping_t> m_map;  // shared mapping
+};
+
+#endif
@@ -0,0 +1,133 @@
+/*
+	License: Zlib
+	see https://gitlab.com/cam900/vgsound_emu/-/blob/main/LICENSE for more details
+
+	Copyright holder(s): cam900
+	Memory interfaces backed by memory mapped ROM files
+
+	See mmap.cpp for more info.
+*/
+
+#ifndef _VGSOUND_EMU_SRC_CORE_MMAP_MMAP_INTF_HPP
+#define _VGSOUND_EMU_SRC_CORE_MMAP_MMAP_INTF_HPP
+
+#pragma once
+
+#include "../../es550x/es550x.hpp"
+#include "../../k007232/k007232.hpp"
+#include "../../k053260/k053260.hpp"
+#include "../util.hpp"
+#include "mmap.hpp"
+
+// Common memory interface (SCC, MSM6295, X1-010, ...)
+class vgsound_emu_mmap_mem_intf : public vgsound_emu_mem_intf
+{
+	public:
+		vgsound_emu_mmap_mem_intf(const vgsound_emu_mmap &rom, u64 offset = 0, u32 size = ~0)
+			: vgsound_emu_mem_intf()
+			, m_rom(rom)
+			, m_span(rom.span(offset, size))
+		{
+		}
+
+		virtual u8 read_byte(u32 address) override { return m_span.read_byte(address); }
+
+		// little endian
+		virtual u16 read_word(u32 address) override
+		{
+			return m_span.read_byte(address) | (u16(m_span.read_byte(address + 1)) << 8);
+		}
+
+		// raw span for direct access (set_rom, set_bank)
+		inline const rom_span_t &span() const { return m_span; }
+
+	private:
+		vgsound_emu_mmap m_rom;	 // keeps mapping alive
+		rom_span_t m_span;		 // mapped window
+};
+
+// K007232, per NE pin windows
+class vgsound_emu_mmap_k007232_intf : public k007232_intf
+{
+	public:
+		vgsound_emu_mmap_k007232_intf()
+			: k007232_intf()
+			, m_rom{vgsound_emu_mmap(), vgsound_emu_mmap()}
+			, m_span{rom_span_t(), rom_span_t()}
+		{
+		}
+
+		void set_rom(u8 ne, const vgsound_emu_mmap &rom, u64 offset = 0, u32 size = 0x20000)
+		{
+			m_rom[ne & 1]  = rom;
+			m_span[ne & 1] = rom.span(offset, size);
+		}
+
+		virtual u8 read_sample(u8 ne, u32 address) override
+		{
+			return m_span[ne & 1].read_byte(address);
+		}
+
+		// raw span for direct access (k007232_core::set_rom)
+		inline const rom_span_t &span(u8 ne) const { return m_span[ne & 1]; }
+
+	private:
+		std::array<vgsound_emu_mmap, 2> m_rom;	// keeps mapping alive
+		std::array<rom_span_t, 2> m_span;		// mapped windows
+};
+
+// K053260
+class vgsound_emu_mmap_k053260_intf : public k053260_intf
+{
+	public:
+		vgsound_emu_mmap_k053260_intf(const vgsound_emu_mmap &rom, u64 offset = 0, u32 size = ~0)
+			: k053260_intf()
+			, m_rom(rom)
+			, m_span(rom.span(offset, size))
+		{
+		}
+
+		virtual u8 read_sample(u32 address) override { return m_span.read_byte(address); }
+
+		// raw span for direct access
+		inline const rom_span_t &span() const { return m_span; }
+
+	private:
+		vgsound_emu_mmap m_rom;	 // keeps mapping alive
+		rom_span_t m_span;		 // mapped window
+};
+
+// ES5504/ES5505/ES5506, 16 bit little endian words per bank
+class vgsound_emu_mmap_es550x_intf : public es550x_intf
+{
+	public:
+		vgsound_emu_mmap_es550x_intf()
+			: es550x_intf()
+			, m_rom{vgsound_emu_mmap()}
+			, m_span{rom_span_t()}
+		{
+		}
+
+		// ES5504: 8 banks (CA), ES5505: 2 banks, ES5506: 4 banks of up to 2M words
+		void set_bank(u8 bank, const vgsound_emu_mmap &rom, u64 offset = 0, u32 words = 0x200000)
+		{
+			m_rom[bank & 7]	 = rom;
+			m_span[bank & 7] = rom.span(offset, words << 1);
+		}
+
+		virtual s16 read_sample(u8 voice, u8 bank, u32 address) override
+		{
+			const rom_span_t &span = m_span[bank & 7];
+			const u32 addr		   = address << 1;
+			return s16(span.read_byte(addr) | (u16(span.read_byte(addr + 1)) << 8));
+		}
+
+		// raw span for direct access
+		inline const rom_span_t &span(u8 bank) const { return m_span[bank & 7]; }
+
+	private:
+		std::array<vgsound_emu_mmap, 8> m_rom;	// keeps mapping alive
+		std::array<rom_span_t, 8> m_span;		// mapped windows
+};
+
+#endif
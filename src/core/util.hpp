@@ -13,9 +13,12 @@
 
 #include <algorithm>
 #include <array>
+#include <cmath>
+#include <cstring>
 #include <iterator>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 namespace vgsound_emu
@@ -107,6 +110,388 @@ namespace vgsound_emu
 			virtual void write_qword(u32 address, u64 data) {}
 	};
 
+	// Read-only memory span for direct access, mirrored with power of 2 address mask
+	class rom_span_t
+	{
+		public:
+			rom_span_t(const u8 *data = nullptr, u32 size = 0) { set(data, size); }
+
+			// setters
+			void set(const u8 *data, u32 size)
+			{
+				m_data = (size != 0) ? data : nullptr;
+				m_size = (data != nullptr) ? size : 0;
+				m_mask = 0;
+				while ((m_size > 1) && (m_mask < (m_size - 1)))
+				{
+					m_mask = (m_mask << 1) | 1;
+				}
+			}
+
+			// accessors
+			inline u8 read_byte(u32 address) const
+			{
+				address &= m_mask;
+				return (address < m_size) ? m_data[address] : 0;
+			}
+
+			// hint for cache line prefetch, span must be valid
+			inline void prefetch(u32 address) const
+			{
+#if defined(__GNUC__) || defined(__clang__)
+				__builtin_prefetch(m_data + std::min(address & m_mask, m_size - 1));
+#endif
+			}
+
+			// getters
+			inline bool valid() const { return m_data != nullptr; }
+
+			inline const u8 *data() const { return m_data; }
+
+			inline u32 size() const { return m_size; }
+
+			inline u32 mask() const { return m_mask; }
+
+		private:
+			const u8 *m_data = nullptr;	 // pointer to memory
+			u32 m_size		 = 0;		 // memory size
+			u32 m_mask		 = 0;		 // address mask for mirroring
+	};
+
+	// Hot path counter for instrumentation, compiled out unless
+	// VGSOUND_EMU_ENABLE_STATS is defined; count() always returns 0 in that case.
+	// Counter members of the stats types below are static in that case, so they are
+	// shared by every instance and take no storage in the owner
+	class stats_counter_t
+	{
+		public:
+#if defined(VGSOUND_EMU_ENABLE_STATS)
+			static constexpr bool enabled = true;
+
+			inline void inc(u64 n = 1) { m_count += n; }
+
+			inline void reset() { m_count = 0; }
+
+			inline u64 count() const { return m_count; }
+
+		private:
+			u64 m_count = 0;  // counted events
+#else
+			static constexpr bool enabled = false;
+
+			inline void inc(u64 n = 1) {}
+
+			inline void reset() {}
+
+			inline u64 count() const { return 0; }
+#endif
+	};
+
+	// Per-voice counters
+	class voice_stats_t
+	{
+		public:
+			void reset()
+			{
+				tick.reset();
+				idle.reset();
+				read.reset();
+				direct.reset();
+				loop.reset();
+			}
+
+			stats_counter_t tick;	 // voice updates
+			stats_counter_t idle;	 // voice updates while stopped or skipped
+			stats_counter_t read;	 // sample reads via memory interface callback
+			stats_counter_t direct;	 // sample reads via direct memory span
+			stats_counter_t loop;	 // loop, end of sample or key off events
+	};
+
+	// Per-core counters, with per-voice breakdown
+	template<u32 Voices>
+	class core_stats_t
+	{
+		public:
+			void reset()
+			{
+				for (voice_stats_t &elem : voice)
+				{
+					elem.reset();
+				}
+				tick.reset();
+				access.reset();
+				edge.reset();
+			}
+
+			// sum of per-voice counters
+			voice_stats_t total() const
+			{
+				voice_stats_t ret;
+				for (const voice_stats_t &elem : voice)
+				{
+					ret.tick.inc(elem.tick.count());
+					ret.idle.inc(elem.idle.count());
+					ret.read.inc(elem.read.count());
+					ret.direct.inc(elem.direct.count());
+					ret.loop.inc(elem.loop.count());
+				}
+				return ret;
+			}
+
+#if defined(VGSOUND_EMU_ENABLE_STATS)
+			std::array<voice_stats_t, Voices> voice;  // per-voice counters
+			stats_counter_t tick;					  // core updates
+			stats_counter_t access;					  // host register reads and writes
+			stats_counter_t edge;					  // clock_pulse_t edge toggles
+#else
+			static std::array<voice_stats_t, Voices> voice;	 // per-voice counters
+			static stats_counter_t tick;						 // core updates
+			static stats_counter_t access;						 // host register reads and writes
+			static stats_counter_t edge;						 // clock_pulse_t edge toggles
+#endif
+	};
+
+#if !defined(VGSOUND_EMU_ENABLE_STATS)
+	template<u32 Voices>
+	std::array<voice_stats_t, Voices> core_stats_t<Voices>::voice;
+
+	template<u32 Voices>
+	stats_counter_t core_stats_t<Voices>::tick;
+
+	template<u32 Voices>
+	stats_counter_t core_stats_t<Voices>::access;
+
+	template<u32 Voices>
+	stats_counter_t core_stats_t<Voices>::edge;
+#endif
+
+	// Core state serializer for save states and rewind
+	// Same serialize function is used for save and load, state is stored in native byte order
+	// and isn't portable between hosts; ROMs, interfaces and debug features aren't included
+	class serializer_t
+	{
+		public:
+			// save; append state into buffer
+			serializer_t(std::vector<u8> &buf)
+				: m_save(&buf)
+				, m_data(nullptr)
+				, m_size(0)
+				, m_pos(0)
+				, m_error(false)
+			{
+			}
+
+			// load; read state from memory
+			serializer_t(const u8 *data, u32 size)
+				: m_save(nullptr)
+				, m_data(data)
+				, m_size(size)
+				, m_pos(0)
+				, m_error(false)
+			{
+			}
+
+			// arithmetic or enum value
+			template<typename T>
+			void item(T &data)
+			{
+				static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value,
+							  "serializer_t: unsupported type");
+				block(&data, sizeof(T));
+			}
+
+			void item(bool &data)
+			{
+				u8 temp = data ? 1 : 0;
+				item(temp);
+				data = temp != 0;
+			}
+
+			template<typename T, size_t N>
+			void item(std::array<T, N> &data)
+			{
+				if (std::is_arithmetic<T>::value)
+				{
+					block(data.data(), u32(sizeof(T) * N));	 // plain memory
+				}
+				else
+				{
+					for (T &elem : data)
+					{
+						item(elem);
+					}
+				}
+			}
+
+			// bitfield value, m_field = s.value<type>(m_field)
+			template<typename T>
+			T value(T data)
+			{
+				item(data);
+				return data;
+			}
+
+			// getters
+			inline bool loading() const { return m_save == nullptr; }
+
+			inline bool error() const { return m_error; }  // state is truncated
+
+			inline u32 pos() const { return m_pos; }
+
+		private:
+			void block(void *data, u32 size)
+			{
+				if (m_save != nullptr)
+				{
+					const u8 *src = reinterpret_cast<const u8 *>(data);
+					m_save->insert(m_save->end(), src, src + size);
+				}
+				else if ((m_pos + size) <= m_size)
+				{
+					std::memcpy(data, m_data + m_pos, size);
+				}
+				else
+				{
+					m_error = true;
+				}
+				m_pos += size;
+			}
+
+			std::vector<u8> *m_save = nullptr;	// save buffer
+			const u8 *m_data		= nullptr;	// load data
+			u32 m_size				= 0;		// load data size
+			u32 m_pos				= 0;		// current position
+			bool m_error			= false;	// out of data
+	};
+
+	// Per-voice output capture for oscilloscope views, disabled until configured
+	// Core writes every (decimation)th voice output into per-voice ring buffers from its tick
+	// loop, reading them from other thread must be synchronized with the core thread
+	// (e.g. between render calls)
+	template<u32 Voices>
+	class voice_scope_t
+	{
+		public:
+			// ring buffer length per voice (0 = disabled) and capture interval
+			void configure(u32 length, u32 decimation = 1)
+			{
+				m_length	 = length;
+				m_decimation = std::max<u32>(1, decimation);
+				reset();
+			}
+
+			void reset()
+			{
+				m_phase = 0;
+				m_pos	= 0;
+				m_count = 0;
+				m_buf.assign(m_length * Voices, 0);
+			}
+
+			inline bool enabled() const { return m_length != 0; }
+
+			// per-sample capture; advance decimation counter, true if this sample is captured
+			inline bool capture()
+			{
+				if (++m_phase < m_decimation)
+				{
+					return false;
+				}
+				m_phase = 0;
+				return true;
+			}
+
+			inline void set(u32 voice, s32 out) { m_buf[(voice * m_length) + m_pos] = out; }
+
+			// advance after all voices are set
+			inline void next()
+			{
+				if (++m_pos >= m_length)
+				{
+					m_pos = 0;
+				}
+				m_count++;
+			}
+
+			// block capture; call set_block/fill_block for each voice, then next_block
+			inline void set_block(u32 voice, const s32 *out, u32 samples)
+			{
+				s32 *buf = &m_buf[voice * m_length];
+				u32 pos	 = m_pos;
+				for (u32 i = first(); i < samples; i += m_decimation)
+				{
+					buf[pos] = out[i];
+					if (++pos >= m_length)
+					{
+						pos = 0;
+					}
+				}
+			}
+
+			// constant output over block
+			inline void fill_block(u32 voice, s32 out, u32 samples)
+			{
+				s32 *buf = &m_buf[voice * m_length];
+				u32 pos	 = m_pos;
+				for (u32 i = first(); i < samples; i += m_decimation)
+				{
+					buf[pos] = out;
+					if (++pos >= m_length)
+					{
+						pos = 0;
+					}
+				}
+			}
+
+			inline void next_block(u32 samples)
+			{
+				const u64 total	   = u64(m_phase) + samples;
+				const u32 captured = u32(total / m_decimation);
+				m_phase			   = u32(total % m_decimation);
+				m_pos			   = u32((u64(m_pos) + captured) % m_length);
+				m_count += captured;
+			}
+
+			// copy latest captured outputs of voice in oldest first order, returns copied samples
+			u32 read(u32 voice, s32 *out, u32 samples) const
+			{
+				if ((!enabled()) || (voice >= Voices))
+				{
+					return 0;
+				}
+				samples		   = u32(std::min<u64>(std::min(samples, m_length), m_count));
+				const s32 *buf = &m_buf[voice * m_length];
+				u32 pos		   = (m_pos + m_length - samples) % m_length;
+				for (u32 i = 0; i < samples; i++)
+				{
+					out[i] = buf[pos];
+					if (++pos >= m_length)
+					{
+						pos = 0;
+					}
+				}
+				return samples;
+			}
+
+			// getters
+			inline u32 length() const { return m_length; }
+
+			inline u32 decimation() const { return m_decimation; }
+
+			inline u64 count() const { return m_count; }  // total captured samples
+
+		private:
+			// offset of first captured sample in next block
+			inline u32 first() const { return m_decimation - 1 - m_phase; }
+
+			u32 m_length	 = 0;  // ring buffer length per voice
+			u32 m_decimation = 1;  // capture every (decimation)th sample
+			u32 m_phase		 = 0;  // decimation counter
+			u32 m_pos		 = 0;  // write position
+			u64 m_count		 = 0;  // total captured samples
+			std::vector<s32> m_buf;	 // voice major ring buffers
+	};
+
 	template<typename T>
 	class clock_pulse_t : public vgsound_emu_core
 	{
@@ -156,6 +541,7 @@ namespace vgsound_emu
 						if (m_current != edge)
 						{
 							m_changed = 1;
+							m_toggle.inc();
 							if (m_current && (!edge))
 							{
 								m_falling = 1;
@@ -178,12 +564,33 @@ namespace vgsound_emu
 
 					inline bool changed() { return m_changed; }
 
+					// instrumentation
+					inline u64 toggles() const { return m_toggle.count(); }
+
+					inline void reset_toggles() { m_toggle.reset(); }
+
+					// save state
+					void serialize(serializer_t &s)
+					{
+						m_current  = s.value<u8>(m_current);
+						m_previous = s.value<u8>(m_previous);
+						m_rising   = s.value<u8>(m_rising);
+						m_falling  = s.value<u8>(m_falling);
+						m_changed  = s.value<u8>(m_changed);
+					}
+
 				private:
 					u8 m_current  : 1;	// current edge
 					u8 m_previous : 1;	// previous edge
 					u8 m_rising	  : 1;	// rising edge
 					u8 m_falling  : 1;	// falling edge
 					u8 m_changed  : 1;	// changed flag
+
+#if defined(VGSOUND_EMU_ENABLE_STATS)
+					stats_counter_t m_toggle;  // edge toggle counter
+#else
+					static stats_counter_t m_toggle;  // edge toggle counter
+#endif
 			};
 
 		public:
@@ -248,6 +655,21 @@ namespace vgsound_emu
 
 			inline T cycle() { return m_cycle; }
 
+			// instrumentation
+			inline u64 toggles() const { return m_edge.toggles(); }
+
+			inline void reset_toggles() { m_edge.reset_toggles(); }
+
+			// save state
+			void serialize(serializer_t &s)
+			{
+				m_edge.serialize(s);
+				s.item(m_width);
+				s.item(m_width_latch);
+				s.item(m_counter);
+				s.item(m_cycle);
+			}
+
 		private:
 			edge_t m_edge;
 			T m_width		= 1;  // clock pulse width
@@ -255,6 +677,11 @@ namespace vgsound_emu
 			T m_counter		= 1;  // clock counter
 			T m_cycle		= 0;  // clock cycle
 	};
+
+#if !defined(VGSOUND_EMU_ENABLE_STATS)
+	template<typename T>
+	stats_counter_t clock_pulse_t<T>::edge_t::m_toggle;
+#endif
 };	// namespace vgsound_emu
 
 using namespace vgsound_emu;
@@ -8,6 +8,9 @@
 
 #include "vox.hpp"
 
+// definition for odr-use, initialized in class
+constexpr s32 vox_core::m_decode_table[49][16];
+
 // reset decoder
 void vox_core::vox_decoder_t::decoder_state_t::reset()
 {
@@ -22,38 +25,38 @@ void vox_core::vox_decoder_t::decoder_state_t::copy_state(decoder_state_t &src)
 	m_step	= src.step();
 }
 
+void vox_core::vox_decoder_t::decoder_state_t::serialize(serializer_t &s)
+{
+	s.item(m_index);
+	s.item(m_step);
+}
+
 // decode single nibble
 void vox_core::vox_decoder_t::decoder_state_t::decode(u8 nibble)
 {
-	const u8 delta = bitfield(nibble, 0, 3);
-	const s16 ss   = m_vox.m_step_table[m_index];  // ss(n)
-
 	// d(n) = (ss(n) * B2) + ((ss(n) / 2) * B1) + ((ss(n) / 4) * B0)
 	// + (ss(n) / 8)
-	s16 d = ss >> 3;
-	if (bitfield(delta, 2))
-	{
-		d += ss;
-	}
-	if (bitfield(delta, 1))
-	{
-		d += (ss >> 1);
-	}
-	if (bitfield(delta, 0))
-	{
-		d += (ss >> 2);
-	}
-
 	// if (B3 = 1) then d(n) = d(n) * (-1) X(n) = X(n-1) * d(n)
-	if (bitfield(nibble, 3))
-	{
-		m_step = std::max(m_step - d, -2048);
-	}
-	else
+	// delta and adjusted step index are fetched from precomputed table
+	const s32 entry = m_vox.m_decode_table[m_index][bitfield(nibble, 0, 4)];
+
+	m_step	= clamp(m_step + (entry >> 8), -2048, 2047);
+	m_index = entry & 0xff;
+}
+
+// decode nibbles, high nibble first
+void vox_core::vox_decoder_t::decoder_state_t::decode_block(const u8 *data, u32 nibbles, s16 *out)
+{
+	s32 step  = m_step;
+	s32 index = m_index;
+	for (u32 i = 0; i < nibbles; i++)
 	{
-		m_step = std::min(m_step + d, 2047);
-	}
+		const s32 entry = m_vox.m_decode_table[index][bitfield(data[i >> 1], (~i & 1) << 2, 4)];
 
-	// adjust step index
-	m_index = clamp(m_index + m_vox.m_index_table[delta], 0, 48);
+		step   = clamp(step + (entry >> 8), -2048, 2047);
+		index  = entry & 0xff;
+		out[i] = step;
+	}
+	m_step	= step;
+	m_index = index;
 }
@@ -33,6 +33,8 @@ class vox_core : public vgsound_emu_core
 						// internal states
 						void reset();
 						void decode(u8 nibble);
+						void decode_block(const u8 *data, u32 nibbles, s16 *out);
+						void serialize(serializer_t &s);
 
 						// getters
 						s8 index() { return m_index; }
@@ -63,6 +65,13 @@ class vox_core : public vgsound_emu_core
 					m_loop_saved = false;
 				}
 
+				void serialize(serializer_t &s)
+				{
+					m_curr.serialize(s);
+					m_loop.serialize(s);
+					s.item(m_loop_saved);
+				}
+
 				void save()
 				{
 					if (!m_loop_saved)
@@ -82,6 +91,12 @@ class vox_core : public vgsound_emu_core
 
 				void decode(u8 nibble) { m_curr.decode(nibble); }
 
+				// decode nibbles from data (high nibble first) into output buffer
+				void decode_block(const u8 *data, u32 nibbles, s16 *out)
+				{
+					m_curr.decode_block(data, nibbles, out);
+				}
+
 				s32 step() { return m_curr.step(); }
 
 			private:
@@ -96,6 +111,109 @@ class vox_core : public vgsound_emu_core
 		  80,  88,	97,	 107, 118, 130, 143, 157, 173, 190, 209,  230,	253,  279,	307, 337, 371,
 		  408, 449, 494, 544, 598, 658, 724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552};
 
+		// precomputed from above tables for each step index and nibble
+		// (signed delta << 8) | next step index
+		static constexpr s32 m_decode_table[49][16] = {
+		  {	   512,	   1536,	2560,	 3584,	  4610,	   5636,	6662,	 7688,
+		   	  -512,	  -1536,   -2560,	-3584,	 -4606,	  -5628,   -6650,	-7672},
+		  {	   512,	   1536,	2560,	 3584,	  4867,	   5893,	6919,	 7945,
+		   	  -512,	  -1536,   -2560,	-3584,	 -4861,	  -5883,   -6905,	-7927},
+		  {	   513,	   1537,	2817,	 3841,	  5380,	   6406,	7688,	 8714,
+		   	  -511,	  -1535,   -2815,	-3839,	 -5372,	  -6394,   -7672,	-8694},
+		  {	   514,	   1794,	3074,	 4354,	  5893,	   7175,	8457,	 9739,
+		   	  -510,	  -1790,   -3070,	-4350,	 -5883,	  -7161,   -8439,	-9717},
+		  {	   515,	   1795,	3331,	 4611,	  6406,	   7688,	9226,	10508,
+		   	  -509,	  -1789,   -3325,	-4605,	 -6394,	  -7672,   -9206,  -10484},
+		  {	   772,	   2308,	3844,	 5380,	  7175,	   8713,   10251,	11789,
+		   	  -764,	  -2300,   -3836,	-5372,	 -7161,	  -8695,  -10229,  -11763},
+		  {	   773,	   2565,	4357,	 6149,	  7944,	   9738,   11532,	13326,
+		   	  -763,	  -2555,   -4347,	-6139,	 -7928,	  -9718,  -11508,  -13298},
+		  {	   774,	   2566,	4614,	 6406,	  8713,	  10507,   12557,	14351,
+		   	  -762,	  -2554,   -4602,	-6394,	 -8695,	 -10485,  -12531,  -14321},
+		  {	  1031,	   3079,	5383,	 7431,	  9738,	  11788,   14094,	16144,
+		   	 -1017,	  -3065,   -5369,	-7417,	 -9718,	 -11764,  -14066,  -16112},
+		  {	  1032,	   3336,	5640,	 7944,	 10507,	  12813,   15119,	17425,
+		   	 -1016,	  -3320,   -5624,	-7928,	-10485,	 -12787,  -15089,  -17391},
+		  {	  1289,	   3849,	6409,	 8969,	 11788,	  14350,   16912,	19474,
+		   	 -1271,	  -3831,   -6391,	-8951,	-11764,	 -14322,  -16880,  -19438},
+		  {	  1290,	   4106,	6922,	 9738,	 12813,	  15631,   18449,	21267,
+		   	 -1270,	  -4086,   -6902,	-9718,	-12787,	 -15601,  -18415,  -21229},
+		  {	  1547,	   4619,	7947,	11019,	 14350,	  17424,   20754,	23828,
+		   	 -1525,	  -4597,   -7925,  -10997,	-14322,	 -17392,  -20718,  -23788},
+		  {	  1548,	   4876,	8460,	11788,	 15631,	  18961,   22547,	25877,
+		   	 -1524,	  -4852,   -8436,  -11764,	-15601,	 -18927,  -22509,  -25835},
+		  {	  1805,	   5645,	9485,	13325,	 17168,	  21010,   24852,	28694,
+		   	 -1779,	  -5619,   -9459,  -13299,	-17136,	 -20974,  -24812,  -28650},
+		  {	  2062,	   6158,   10510,	14606,	 18961,	  23059,   27413,	31511,
+		   	 -2034,	  -6130,  -10482,  -14578,	-18927,	 -23021,  -27371,  -31465},
+		  {	  2319,	   6927,   11535,	16143,	 21010,	  25620,   30230,	34840,
+		   	 -2289,	  -6897,  -11505,  -16113,	-20974,	 -25580,  -30186,  -34792},
+		  {	  2576,	   7696,   12816,	17936,	 23059,	  28181,   33303,	38425,
+		   	 -2544,	  -7664,  -12784,  -17904,	-23021,	 -28139,  -33257,  -38375},
+		  {	  2833,	   8465,   14097,	19729,	 25364,	  30998,   36632,	42266,
+		   	 -2799,	  -8431,  -14063,  -19695,	-25324,	 -30954,  -36584,  -42214},
+		  {	  3090,	   9234,   15378,	21522,	 27925,	  34071,   40217,	46363,
+		   	 -3054,	  -9198,  -15342,  -21486,	-27883,	 -34025,  -40167,  -46309},
+		  {	  3347,	  10003,   16915,	23571,	 30742,	  37400,   44314,	50972,
+		   	 -3309,	  -9965,  -16877,  -23533,	-30698,	 -37352,  -44262,  -50916},
+		  {	  3604,	  11028,   18708,	26132,	 33815,	  41241,   48923,	56349,
+		   	 -3564,	 -10988,  -18668,  -26092,	-33769,	 -41191,  -48869,  -56291},
+		  {	  4117,	  12309,   20757,	28949,	 37400,	  45594,   54044,	62238,
+		   	 -4075,	 -12267,  -20715,  -28907,	-37352,	 -45542,  -53988,  -62178},
+		  {	  4374,	  13334,   22550,	31510,	 40985,	  49947,   59165,	68127,
+		   	 -4330,	 -13290,  -22506,  -31466,	-40935,	 -49893,  -59107,  -68065},
+		  {	  4887,	  14871,   24855,	34839,	 45082,	  55068,   65054,	75040,
+		   	 -4841,	 -14825,  -24809,  -34793,	-45030,	 -55012,  -64994,  -74976},
+		  {	  5400,	  16408,   27416,	38424,	 49691,	  60701,   71711,	82721,
+		   	 -5352,	 -16360,  -27368,  -38376,	-49637,	 -60643,  -71649,  -82655},
+		  {	  5913,	  17945,   30233,	42265,	 54556,	  66590,   78880,	90914,
+		   	 -5863,	 -17895,  -30183,  -42215,	-54500,	 -66530,  -78816,  -90846},
+		  {	  6682,	  19994,   33306,	46618,	 60189,	  73503,   86817,  100131,
+		   	 -6630,	 -19942,  -33254,  -46566,	-60131,	 -73441,  -86751, -100061},
+		  {	  7195,	  21787,   36635,	51227,	 66078,	  80672,   95522,  110116,
+		   	 -7141,	 -21733,  -36581,  -51173,	-66018,	 -80608,  -95454, -110044},
+		  {	  7964,	  24092,   40220,	56348,	 72735,	  88865,  104995,  121125,
+		   	 -7908,	 -24036,  -40164,  -56292,	-72673,	 -88799, -104925, -121051},
+		  {	  8733,	  26397,   44317,	61981,	 80160,	  97826,  115748,  133414,
+		   	 -8675,	 -26339,  -44259,  -61923,	-80096,	 -97758, -115676, -133338},
+		  {	  9758,	  29214,   48926,	68382,	 88353,	 107811,  127525,  146983,
+		   	 -9698,	 -29154,  -48866,  -68322,	-88287, -107741, -127451, -146905},
+		  {	 10783,	  32287,   53791,	75295,	 97058,	 118564,  140070,  161576,
+		    -10721,	 -32225,  -53729,  -75233,	-96990, -118492, -139994, -161496},
+		  {	 11808,	  35360,   59168,	82720,	106787,	 130341,  154151,  177705,
+		    -11744,	 -35296,  -59104,  -82656, -106717, -130267, -154073, -177623},
+		  {	 13089,	  39201,   65313,	91425,	117540,	 143654,  169768,  195882,
+		    -13023,	 -39135,  -65247,  -91359, -117468, -143578, -169688, -195798},
+		  {	 14370,	  43042,   71714,  100386,	129317,	 157991,  186665,  215339,
+		    -14302,	 -42974,  -71646, -100318, -129243, -157913, -186583, -215253},
+		  {	 15651,	  47139,   78883,  110371,	142118,	 173608,  205354,  236844,
+		    -15581,	 -47069,  -78813, -110301, -142042, -173528, -205270, -236756},
+		  {	 17444,	  52260,   87076,  121892,	156711,	 191529,  226347,  261165,
+		    -17372,	 -52188,  -87004, -121820, -156633, -191447, -226261, -261075},
+		  {	 18981,	  57125,   95525,  133669,	172072,	 210218,  248620,  286766,
+		    -18907,	 -57051,  -95451, -133595, -171992, -210134, -248532, -286674},
+		  {	 21030,	  63014,  105254,  147238,	189481,	 231467,  273709,  315695,
+		    -20954,	 -62938, -105178, -147162, -189399, -231381, -273619, -315601},
+		  {	 23079,	  69415,  115751,  162087,	208426,	 254764,  301102,  347440,
+		    -23001,	 -69337, -115673, -162009, -208342, -254676, -301010, -347344},
+		  {	 25384,	  76328,  127272,  178216,	229163,	 280109,  331055,  382000,
+		    -25304,	 -76248, -127192, -178136, -229077, -280019, -330961, -381904},
+		  {	 27945,	  84009,  140073,  196137,	252204,	 308270,  364336,  420400,
+		    -27863,	 -83927, -139991, -196055, -252116, -308178, -364240, -420304},
+		  {	 30762,	  92202,  153898,  215338,	277293,	 338735,  400432,  461872,
+		    -30678,	 -92118, -153814, -215254, -277203, -338641, -400336, -461776},
+		  {	 33835,	 101675,  169515,  237355,	305198,	 373040,  440880,  508720,
+		    -33749, -101589, -169429, -237269, -305106, -372944, -440784, -508624},
+		  {	 37164,	 111660,  186412,  260908,	335663,	 410160,  484912,  559408,
+		    -37076, -111572, -186324, -260820, -335569, -410064, -484816, -559312},
+		  {	 41005,	 122925,  205101,  287021,	369200,	 451120,  533296,  615216,
+		    -40915, -122835, -205011, -286931, -369104, -451024, -533200, -615120},
+		  {	 45102,	 135214,  225582,  315694,	406320,	 496432,  586800,  676912,
+		    -45010, -135122, -225490, -315602, -406224, -496336, -586704, -676816},
+		  {	 49711,	 149039,  248367,  347695,	447024,	 546352,  645680,  745008,
+		    -49617, -148945, -248273, -347601, -446928, -546256, -645584, -744912}
+		};
+
 	public:
 		vox_core(std::string tag)
 			: vgsound_emu_core(tag)
@@ -13,6 +13,7 @@
 // Internal functions
 void es5504_core::tick()
 {
+	m_stats.tick.inc();
 	m_voice_update = false;
 	m_voice_end	   = false;
 	// /CAS, E
@@ -79,6 +80,7 @@ void es5504_core::tick()
 // less cycle accurate, but less CPU heavy routine
 void es5504_core::tick_perf()
 {
+	m_stats.tick.inc();
 	m_voice_update = false;
 	m_voice_end	   = false;
 	// update
@@ -106,6 +108,43 @@ void es5504_core::tick_perf()
 	m_host_intf.update_strobe();
 }
 
+// render 16 channel outputs, held until channel assigned voice is updated
+void es5504_core::render_perf(s32 **out, u32 samples)
+{
+	std::array<u32, 16> hold_start;	 // start of current hold for each channel
+	std::array<s32, 16> hold_out;	 // held output for each channel
+	hold_start.fill(0);
+	std::copy(m_out.begin(), m_out.end(), hold_out.begin());
+
+	for (u32 s = 0; s < samples; s++)
+	{
+		m_out_dirty = 0;
+		tick_perf();
+		// flush hold of refreshed channels only, others are keep holding
+		for (u8 ch = 0; m_out_dirty != 0; ch++, m_out_dirty >>= 1)
+		{
+			if (bitfield(m_out_dirty, 0) && (m_out[ch] != hold_out[ch]))
+			{
+				if (out[ch] != nullptr)
+				{
+					std::fill(&out[ch][hold_start[ch]], &out[ch][s], hold_out[ch]);
+				}
+				hold_start[ch] = s;
+				hold_out[ch]   = m_out[ch];
+			}
+		}
+	}
+
+	// flush remaining holds
+	for (u8 ch = 0; ch < 16; ch++)
+	{
+		if (out[ch] != nullptr)
+		{
+			std::fill(&out[ch][hold_start[ch]], &out[ch][samples], hold_out[ch]);
+		}
+	}
+}
+
 void es5504_core::voice_tick()
 {
 	// Voice updates every 2 E clock cycle (= 1 CHSTRB cycle or 4 BCLK clock cycle)
@@ -116,12 +155,22 @@ void es5504_core::voice_tick()
 		m_voice[m_voice_cycle].tick(m_voice_cycle);
 
 		// Refresh output (Multiplexed analog output)
-		m_out[m_voice[m_voice_cycle].cr().ca()] = m_voice[m_voice_cycle].out();
+		const u8 ca = m_voice[m_voice_cycle].cr().ca();
+		m_out[ca]	= m_voice[m_voice_cycle].out();
+		m_out_dirty |= 1 << ca;
 
 		if ((++m_voice_cycle) > std::min<u8>(24, m_active))	 // ~ 25 voices
 		{
 			m_voice_end	  = true;
 			m_voice_cycle = 0;
+			if (m_scope.enabled() && m_scope.capture())
+			{
+				for (u8 v = 0; v < 25; v++)
+				{
+					m_scope.set(v, m_voice[v].out());
+				}
+				m_scope.next();
+			}
 		}
 
 		m_voice_fetch = 0;
@@ -130,6 +179,12 @@ void es5504_core::voice_tick()
 
 void es5504_core::voice_t::fetch(u8 voice, u8 cycle)
 {
+	if (m_idle)
+	{
+		return;
+	}
+
+	m_host.m_stats.voice[voice].read.inc();
 	m_alu.set_sample(
 	  cycle,
 	  m_host.m_intf.read_sample(voice,
@@ -140,9 +195,17 @@ void es5504_core::voice_t::fetch(u8 voice, u8 cycle)
 void es5504_core::voice_t::tick(u8 voice)
 {
 	m_out = 0;
+	m_host.m_stats.voice[voice].tick.inc();
+
+	// Stopped voice with settled filter, skip until register writes
+	if (m_idle)
+	{
+		m_host.m_stats.voice[voice].idle.inc();
+		return;
+	}
 
 	// Filter execute
-	m_filter.tick(m_alu.interpolation());
+	const bool settled = filter_exec();
 
 	if (m_alu.busy())
 	{
@@ -154,6 +217,7 @@ void es5504_core::voice_t::tick(u8 voice)
 		if (m_alu.tick())
 		{
 			m_alu.loop_exec();
+			m_host.m_stats.voice[voice].loop.inc();
 		}
 
 		// ADC check
@@ -162,6 +226,7 @@ void es5504_core::voice_t::tick(u8 voice)
 
 	// Update IRQ
 	m_alu.irq_exec(m_host.m_intf, m_host.m_irqv, voice);
+	m_idle = settled && (!m_alu.irq());
 }
 
 // ADC; Correct?
@@ -183,18 +248,40 @@ void es5504_core::reset()
 
 	m_adc = 0;
 	std::fill(m_out.begin(), m_out.end(), 0);
+	m_out_dirty = 0;
 }
 
 void es5504_core::voice_t::reset()
 {
-	es550x_shared_core::es550x_voice_t::reset();
+	es550x_voice_t::reset();
 	m_volume = 0;
 	m_out	 = 0;
 }
 
+void es5504_core::serialize(serializer_t &s)
+{
+	es550x_shared_core::serialize(s);
+	for (auto &elem : m_voice)
+	{
+		elem.serialize(s);
+	}
+
+	s.item(m_adc);
+	s.item(m_out);
+	s.item(m_out_dirty);
+}
+
+void es5504_core::voice_t::serialize(serializer_t &s)
+{
+	es550x_voice_t::serialize(s);
+	s.item(m_volume);
+	s.item(m_out);
+}
+
 // Accessors
 u16 es5504_core::host_r(u8 address)
 {
+	m_stats.access.inc();
 	if (!m_host_intf.host_access())
 	{
 		m_ha = address;
@@ -212,6 +299,7 @@ u16 es5504_core::host_r(u8 address)
 
 void es5504_core::host_w(u8 address, u16 data)
 {
+	m_stats.access.inc();
 	if (!m_host_intf.host_access())
 	{
 		m_ha = address;
@@ -383,6 +471,7 @@ void es5504_core::regs_w(u8 page, u8 address, u16 data, bool cpu_access)
 		if (voice < 25)
 		{
 			voice_t &v = m_voice[voice];
+			v.set_dirty();
 			if (bitfield(page, 5))	// Page 32 - 56
 			{
 				switch (address)
@@ -20,12 +20,12 @@ class es5504_core : public es550x_shared_core
 {
 	private:
 		// es5504 voice classes
-		class voice_t : public es550x_voice_t
+		class voice_t : public es550x_voice_t<20, 9, false>
 		{
 			public:
 				// constructor
 				voice_t(es5504_core &host)
-					: es550x_voice_t("es5504_voice", 20, 9, false)
+					: es550x_voice_t("es5504_voice")
 					, m_host(host)
 					, m_volume(0)
 					, m_out(0)
@@ -33,9 +33,10 @@ class es5504_core : public es550x_shared_core
 				}
 
 				// internal state
-				virtual void reset() override;
-				virtual void fetch(u8 voice, u8 cycle) override;
-				virtual void tick(u8 voice) override;
+				void reset();
+				void fetch(u8 voice, u8 cycle);
+				void tick(u8 voice);
+				void serialize(serializer_t &s);
 
 				// setters
 				inline void set_volume(u16 volume) { m_volume = volume; }
@@ -63,6 +64,7 @@ class es5504_core : public es550x_shared_core
 					  *this, *this, *this, *this, *this, *this, *this}
 			, m_adc(0)
 			, m_out{0}
+			, m_out_dirty(0)
 		{
 		}
 
@@ -73,10 +75,16 @@ class es5504_core : public es550x_shared_core
 		// internal state
 		virtual void reset() override;
 		virtual void tick() override;
+		virtual void serialize(serializer_t &s) override;
 
 		// less cycle accurate, but also less cpu heavy update routine
 		void tick_perf();
 
+		// render 16 analog output channels into planar buffers with tick_perf
+		// each sample is single voice update (= 1 tick_perf call), channel outputs are hold until
+		// next update of channel assigned voice. null pointer for unused channels
+		void render_perf(s32 **out, u32 samples);
+
 		// 16 analog output channels
 		inline s32 out(u8 ch) { return m_out[ch & 0xf]; }
 
@@ -106,14 +114,13 @@ class es5504_core : public es550x_shared_core
 		inline s32 voice_out(u8 voice) { return (voice < 25) ? m_voice[voice].out() : 0; }
 
 	protected:
-		virtual inline u8 max_voices() override { return 25; }
-
-		virtual void voice_tick() override;
+		void voice_tick();
 
 	private:
 		std::array<voice_t, 25> m_voice;  // 25 voices
 		u16 m_adc				  = 0;	  // ADC register
 		std::array<s32, 16> m_out = {0};  // 16 channel outputs
+		u16 m_out_dirty			  = 0;	  // Updated channel outputs, for render_perf
 };
 
 #endif
@@ -13,6 +13,7 @@
 // Internal functions
 void es5505_core::tick()
 {
+	m_stats.tick.inc();
 	m_voice_update = false;
 	m_voice_end	   = false;
 	// CLKIN
@@ -151,6 +152,7 @@ void es5505_core::tick()
 // less cycle accurate, but less CPU heavy routine
 void es5505_core::tick_perf()
 {
+	m_stats.tick.inc();
 	m_voice_update = false;
 	m_voice_end	   = false;
 	// output
@@ -184,6 +186,46 @@ void es5505_core::tick_perf()
 	m_host_intf.update_strobe();
 }
 
+// voices in cycle are stopped with settled filter, and every channel outputs are zero
+bool es5505_core::idle()
+{
+	const u8 last = clamp<u8>(m_active, 7, 31);
+	if (m_scope.enabled() || (m_voice_cycle > last))
+	{
+		return false;
+	}
+
+	for (output_t &elem : m_ch)
+	{
+		if ((elem.left() != 0) || (elem.right() != 0))
+		{
+			return false;
+		}
+	}
+	for (u8 v = 0; v < 32; v++)
+	{
+		voice_t &elem = m_voice[v];
+		if (((v <= last) && (!elem.idle())) || (elem.ch().left() != 0) ||
+			(elem.ch().right() != 0))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+// idle state is repeated in every voice cycle, so only remainder is executed
+void es5505_core::skip_idle(u64 ticks)
+{
+	const u64 period = u64(clamp<u8>(m_active, 7, 31)) + 1;
+	const u64 rest	 = ticks % period;
+	m_stats.tick.inc(ticks - rest);
+	for (u64 t = 0; t < rest; t++)
+	{
+		tick_perf();
+	}
+}
+
 void es5505_core::voice_tick()
 {
 	// Voice updates every 2 E clock cycle (or 4 BCLK clock cycle)
@@ -203,11 +245,21 @@ void es5505_core::voice_tick()
 				elem.reset();
 			}
 
-			for (auto &elem : m_voice)
+			const bool scope = m_scope.enabled() && m_scope.capture();
+			for (u8 v = 0; v < 32; v++)
 			{
+				voice_t &elem = m_voice[v];
+				if (scope)
+				{
+					m_scope.set(v, elem.ch().left() + elem.ch().right());
+				}
 				m_ch[bitfield(elem.cr().ca(), 0, 2)] += elem.ch();
 				elem.ch().reset();
 			}
+			if (scope)
+			{
+				m_scope.next();
+			}
 		}
 		m_voice_fetch = 0;
 	}
@@ -215,6 +267,12 @@ void es5505_core::voice_tick()
 
 void es5505_core::voice_t::fetch(u8 voice, u8 cycle)
 {
+	if (m_idle)
+	{
+		return;
+	}
+
+	m_host.m_stats.voice[voice].read.inc();
 	m_alu.set_sample(
 	  cycle,
 	  m_host.m_intf.read_sample(voice,
@@ -225,9 +283,17 @@ void es5505_core::voice_t::fetch(u8 voice, u8 cycle)
 void es5505_core::voice_t::tick(u8 voice)
 {
 	m_ch.reset();
+	m_host.m_stats.voice[voice].tick.inc();
+
+	// Stopped voice with settled filter, skip until register writes
+	if (m_idle)
+	{
+		m_host.m_stats.voice[voice].idle.inc();
+		return;
+	}
 
 	// Filter execute
-	m_filter.tick(m_alu.interpolation());
+	const bool settled = filter_exec();
 
 	if (m_alu.busy())
 	{
@@ -239,11 +305,13 @@ void es5505_core::voice_t::tick(u8 voice)
 		if (m_alu.tick())
 		{
 			m_alu.loop_exec();
+			m_host.m_stats.voice[voice].loop.inc();
 		}
 	}
 
 	// Update IRQ
 	m_alu.irq_exec(m_host.m_intf, m_host.m_irqv, voice);
+	m_idle = settled && (!m_alu.irq());
 }
 
 // volume calculation
@@ -286,17 +354,62 @@ void es5505_core::reset()
 	}
 }
 
+// Instrumentation
+void es5505_core::reset_stats()
+{
+	es550x_shared_core::reset_stats();
+	m_bclk.reset_toggles();
+	m_lrclk.reset_toggles();
+}
+
+u64 es5505_core::clock_edges()
+{
+	return es550x_shared_core::clock_edges() + m_bclk.toggles() + m_lrclk.toggles();
+}
+
 void es5505_core::voice_t::reset()
 {
-	es550x_shared_core::es550x_voice_t::reset();
+	es550x_voice_t::reset();
 	m_lvol = 0;
 	m_rvol = 0;
 	m_ch.reset();
 }
 
+void es5505_core::serialize(serializer_t &s)
+{
+	es550x_shared_core::serialize(s);
+	for (auto &elem : m_voice)
+	{
+		elem.serialize(s);
+	}
+
+	m_sermode.serialize(s);
+	m_bclk.serialize(s);
+	m_lrclk.serialize(s);
+	s.item(m_wclk);
+	s.item(m_wclk_lr);
+	s.item(m_output_bit);
+	for (u8 i = 0; i < 4; i++)
+	{
+		m_ch[i].serialize(s);
+		m_output[i].serialize(s);
+		m_output_temp[i].serialize(s);
+		m_output_latch[i].serialize(s);
+	}
+}
+
+void es5505_core::voice_t::serialize(serializer_t &s)
+{
+	es550x_voice_t::serialize(s);
+	s.item(m_lvol);
+	s.item(m_rvol);
+	m_ch.serialize(s);
+}
+
 // Accessors
 u16 es5505_core::host_r(u8 address)
 {
+	m_stats.access.inc();
 	if (!m_host_intf.host_access())
 	{
 		m_ha = address;
@@ -314,6 +427,7 @@ u16 es5505_core::host_r(u8 address)
 
 void es5505_core::host_w(u8 address, u16 data)
 {
+	m_stats.access.inc();
 	if (!m_host_intf.host_access())
 	{
 		m_ha = address;
@@ -574,6 +688,7 @@ void es5505_core::regs_w(u8 page, u8 address, u16 data)
 		{
 			const u8 voice = bitfield(page, 0, 5);	// Voice select
 			voice_t &v	   = m_voice[voice];
+			v.set_dirty();
 			if (bitfield(page, 5))	// Page 32 - 56
 			{
 				switch (address)
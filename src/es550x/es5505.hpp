@@ -35,6 +35,12 @@ class es5505_core : public es550x_shared_core
 					m_right = 0;
 				}
 
+				void serialize(serializer_t &s)
+				{
+					s.item(m_left);
+					s.item(m_right);
+				}
+
 				inline void copy_output(output_t &src)
 				{
 					m_left	= src.left();
@@ -97,12 +103,12 @@ class es5505_core : public es550x_shared_core
 		};
 
 		// es5505 voice classes
-		class voice_t : public es550x_voice_t
+		class voice_t : public es550x_voice_t<20, 9, false>
 		{
 			public:
 				// constructor
 				voice_t(es5505_core &host)
-					: es550x_voice_t("es5505_voice", 20, 9, false)
+					: es550x_voice_t("es5505_voice")
 					, m_host(host)
 					, m_lvol(0)
 					, m_rvol(0)
@@ -111,9 +117,10 @@ class es5505_core : public es550x_shared_core
 				}
 
 				// internal state
-				virtual void reset() override;
-				virtual void fetch(u8 voice, u8 cycle) override;
-				virtual void tick(u8 voice) override;
+				void reset();
+				void fetch(u8 voice, u8 cycle);
+				void tick(u8 voice);
+				void serialize(serializer_t &s);
 
 				// setters
 				inline void set_lvol(u8 lvol) { m_lvol = lvol; }
@@ -157,6 +164,14 @@ class es5505_core : public es550x_shared_core
 					m_msb	  = 0;
 				}
 
+				void serialize(serializer_t &s)
+				{
+					m_adc	  = s.value<u8>(m_adc);
+					m_test	  = s.value<u8>(m_test);
+					m_sony_bb = s.value<u8>(m_sony_bb);
+					m_msb	  = s.value<u8>(m_msb);
+				}
+
 				// setters
 				void write(u16 data)
 				{
@@ -217,10 +232,20 @@ class es5505_core : public es550x_shared_core
 		// internal state
 		virtual void reset() override;
 		virtual void tick() override;
+		virtual void serialize(serializer_t &s) override;
+
+		// instrumentation
+		virtual void reset_stats() override;
 
 		// less cycle accurate, but also less cpu heavy update routine
 		void tick_perf();
 
+		// silence detection for auto sleep, true if every voice is idle and outputs are zero
+		bool idle();
+
+		// advance tick_perf() calls in idle state, same as calling tick_perf() for ticks times
+		void skip_idle(u64 ticks);
+
 		// clock outputs
 		inline bool bclk() { return m_bclk.current_edge(); }
 
@@ -278,9 +303,9 @@ class es5505_core : public es550x_shared_core
 		inline s32 voice_rout(u8 voice) { return (voice < 32) ? m_voice[voice].ch().right() : 0; }
 
 	protected:
-		virtual inline u8 max_voices() override { return 32; }
+		void voice_tick();
 
-		virtual void voice_tick() override;
+		virtual u64 clock_edges() override;
 
 	private:
 		std::array<voice_t, 32> m_voice;  // 32 voices
@@ -13,6 +13,7 @@
 // Internal functions
 void es5506_core::tick()
 {
+	m_stats.tick.inc();
 	m_voice_update = false;
 	m_voice_end	   = false;
 	// CLKIN
@@ -193,6 +194,7 @@ void es5506_core::tick()
 // less cycle accurate, but less CPU heavy routine
 void es5506_core::tick_perf()
 {
+	m_stats.tick.inc();
 	m_voice_update = false;
 	m_voice_end	   = false;
 	// output
@@ -203,7 +205,8 @@ void es5506_core::tick_perf()
 		{
 			for (int c = 0; c < 6; c++)
 			{
-				m_output[c].clamp20(m_ch[c] >> output_bits);
+				output_t ch = m_ch[c];	// shift copy, channel accumulator is readable
+				m_output[c].clamp20(ch >> output_bits);
 			}
 		}
 	}
@@ -240,6 +243,47 @@ void es5506_core::tick_perf()
 	m_host_intf.update_strobe();
 }
 
+// voices in cycle are stopped with settled filter, and every channel outputs are zero
+bool es5506_core::idle()
+{
+	const u8 last = clamp<u8>(m_active, 4, 31);
+	if (m_scope.enabled() || (m_voice_cycle > last))
+	{
+		return false;
+	}
+
+	for (output_t &elem : m_ch)
+	{
+		if ((elem.left() != 0) || (elem.right() != 0))
+		{
+			return false;
+		}
+	}
+	for (u8 v = 0; v < 32; v++)
+	{
+		voice_t &elem = m_voice[v];
+		if (((v <= last) && (!elem.idle())) || (elem.ch().left() != 0) ||
+			(elem.ch().right() != 0))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+// idle state is repeated in every 8 voice cycles (filter counter for slow ramp),
+// so only remainder is executed
+void es5506_core::skip_idle(u64 ticks)
+{
+	const u64 period = (u64(clamp<u8>(m_active, 4, 31)) + 1) * 8;
+	const u64 rest	 = ticks % period;
+	m_stats.tick.inc(ticks - rest);
+	for (u64 t = 0; t < rest; t++)
+	{
+		tick_perf();
+	}
+}
+
 void es5506_core::voice_tick()
 {
 	// Voice updates every 2 E clock cycle (or 4 BCLK clock cycle)
@@ -259,8 +303,14 @@ void es5506_core::voice_tick()
 				elem.reset();
 			}
 
-			for (voice_t &elem : m_voice)
+			const bool scope = m_scope.enabled() && m_scope.capture();
+			for (u8 v = 0; v < 32; v++)
 			{
+				voice_t &elem = m_voice[v];
+				if (scope)
+				{
+					m_scope.set(v, elem.left_out() + elem.right_out());
+				}
 				const u8 ca = bitfield<u8>(elem.cr().ca(), 0, 3);
 				if (ca < 6)
 				{
@@ -268,6 +318,10 @@ void es5506_core::voice_tick()
 				}
 				elem.ch().reset();
 			}
+			if (scope)
+			{
+				m_scope.next();
+			}
 		}
 		m_voice_fetch = 0;
 	}
@@ -275,6 +329,12 @@ void es5506_core::voice_tick()
 
 void es5506_core::voice_t::fetch(u8 voice, u8 cycle)
 {
+	if (m_idle)
+	{
+		return;
+	}
+
+	m_host.m_stats.voice[voice].read.inc();
 	m_alu.set_sample(
 	  cycle,
 	  m_host.m_intf.read_sample(voice,
@@ -289,9 +349,18 @@ void es5506_core::voice_t::fetch(u8 voice, u8 cycle)
 void es5506_core::voice_t::tick(u8 voice)
 {
 	m_ch.reset();
+	m_host.m_stats.voice[voice].tick.inc();
+
+	// Stopped voice with settled filter and idle envelope, skip until register writes
+	if (m_idle)
+	{
+		m_host.m_stats.voice[voice].idle.inc();
+		m_filtcount = bitfield(m_filtcount + 1, 0, 3);
+		return;
+	}
 
 	// Filter execute
-	m_filter.tick(m_alu.interpolation());
+	const bool settled = filter_exec();
 
 	if (m_alu.busy())
 	{
@@ -303,6 +372,7 @@ void es5506_core::voice_t::tick(u8 voice)
 		if (m_alu.tick())
 		{
 			m_alu.loop_exec();
+			m_host.m_stats.voice[voice].loop.inc();
 		}
 	}
 	// Envelope
@@ -338,6 +408,7 @@ void es5506_core::voice_t::tick(u8 voice)
 
 	// Update IRQ
 	m_alu.irq_exec(m_host.m_intf, m_host.m_irqv, voice);
+	m_idle = settled && (m_ecount == 0) && (!m_alu.irq());
 }
 
 // Compressed format
@@ -398,9 +469,22 @@ void es5506_core::reset()
 	}
 }
 
+// Instrumentation
+void es5506_core::reset_stats()
+{
+	es550x_shared_core::reset_stats();
+	m_bclk.reset_toggles();
+	m_lrclk.reset_toggles();
+}
+
+u64 es5506_core::clock_edges()
+{
+	return es550x_shared_core::clock_edges() + m_bclk.toggles() + m_lrclk.toggles();
+}
+
 void es5506_core::voice_t::reset()
 {
-	es550x_shared_core::es550x_voice_t::reset();
+	es550x_voice_t::reset();
 	m_lvol	 = 0;
 	m_rvol	 = 0;
 	m_lvramp = 0;
@@ -413,9 +497,55 @@ void es5506_core::voice_t::reset()
 	m_mute = false;
 }
 
+void es5506_core::serialize(serializer_t &s)
+{
+	es550x_shared_core::serialize(s);
+	for (auto &elem : m_voice)
+	{
+		elem.serialize(s);
+	}
+
+	s.item(m_read_latch);
+	s.item(m_write_latch);
+	s.item(m_w_st);
+	s.item(m_w_end);
+	s.item(m_lr_end);
+	m_mode.serialize(s);
+	s.item(m_w_st_curr);
+	s.item(m_w_end_curr);
+	m_bclk.serialize(s);
+	m_lrclk.serialize(s);
+	s.item(m_wclk);
+	s.item(m_wclk_lr);
+	s.item(m_output_bit);
+	for (u8 i = 0; i < 6; i++)
+	{
+		m_ch[i].serialize(s);
+		m_output[i].serialize(s);
+		m_output_temp[i].serialize(s);
+		m_output_latch[i].serialize(s);
+	}
+}
+
+// mute flag is debug setting, not saved
+void es5506_core::voice_t::serialize(serializer_t &s)
+{
+	es550x_voice_t::serialize(s);
+	s.item(m_lvol);
+	s.item(m_rvol);
+	s.item(m_lvramp);
+	s.item(m_rvramp);
+	s.item(m_ecount);
+	m_k2ramp.serialize(s);
+	m_k1ramp.serialize(s);
+	s.item(m_filtcount);
+	m_ch.serialize(s);
+}
+
 // Accessors
 u8 es5506_core::host_r(u8 address)
 {
+	m_stats.access.inc();
 	if (!m_host_intf.host_access())
 	{
 		m_ha = address;
@@ -433,6 +563,7 @@ u8 es5506_core::host_r(u8 address)
 
 void es5506_core::host_w(u8 address, u8 data)
 {
+	m_stats.access.inc();
 	if (!m_host_intf.host_access())
 	{
 		m_ha = address;
@@ -757,6 +888,7 @@ void es5506_core::regs_w(u8 page, u8 address, u32 data)
 		{
 			const u8 voice = bitfield(page, 0, 5);	// Voice select
 			voice_t &v	   = m_voice[voice];
+			v.set_dirty();
 			if (bitfield(page, 5))	// Page 32 - 63
 			{
 				switch (address)
@@ -35,6 +35,12 @@ class es5506_core : public es550x_shared_core
 					m_right = 0;
 				}
 
+				void serialize(serializer_t &s)
+				{
+					s.item(m_left);
+					s.item(m_right);
+				}
+
 				inline void copy_output(output_t &src)
 				{
 					m_left	= src.left();
@@ -97,7 +103,7 @@ class es5506_core : public es550x_shared_core
 		};
 
 		// es5506 voice classes
-		class voice_t : public es550x_voice_t
+		class voice_t : public es550x_voice_t<21, 11, true>
 		{
 			private:
 				// es5506 Filter ramp class
@@ -117,6 +123,12 @@ class es5506_core : public es550x_shared_core
 							m_ramp = 0;
 						};
 
+						void serialize(serializer_t &s)
+						{
+							m_slow = s.value<u16>(m_slow);
+							s.item(m_ramp);
+						}
+
 						// Setters
 						inline void write(u16 data)
 						{
@@ -137,7 +149,7 @@ class es5506_core : public es550x_shared_core
 			public:
 				// constructor
 				voice_t(es5506_core &host)
-					: es550x_voice_t("es5506_voice", 21, 11, true)
+					: es550x_voice_t("es5506_voice")
 					, m_host(host)
 					, m_lvol(0)
 					, m_rvol(0)
@@ -153,9 +165,10 @@ class es5506_core : public es550x_shared_core
 				}
 
 				// internal state
-				virtual void reset() override;
-				virtual void fetch(u8 voice, u8 cycle) override;
-				virtual void tick(u8 voice) override;
+				void reset();
+				void fetch(u8 voice, u8 cycle);
+				void tick(u8 voice);
+				void serialize(serializer_t &s);
 
 				// Setters
 				inline void set_lvol(s32 lvol) { m_lvol = lvol; }
@@ -238,6 +251,15 @@ class es5506_core : public es550x_shared_core
 					m_dual	   = 0;
 				}
 
+				void serialize(serializer_t &s)
+				{
+					m_lrclk_en = s.value<u8>(m_lrclk_en);
+					m_wclk_en  = s.value<u8>(m_wclk_en);
+					m_bclk_en  = s.value<u8>(m_bclk_en);
+					m_master   = s.value<u8>(m_master);
+					m_dual	   = s.value<u8>(m_dual);
+				}
+
 				// accessors
 				void write(u8 data)
 				{
@@ -301,10 +323,20 @@ class es5506_core : public es550x_shared_core
 		// internal state
 		virtual void reset() override;
 		virtual void tick() override;
+		virtual void serialize(serializer_t &s) override;
+
+		// instrumentation
+		virtual void reset_stats() override;
 
 		// less cycle accurate, but also less cpu heavy update routine
 		void tick_perf();
 
+		// silence detection for auto sleep, true if every voice is idle and outputs are zero
+		bool idle();
+
+		// advance tick_perf() calls in idle state, same as calling tick_perf() for ticks times
+		void skip_idle(u64 ticks);
+
 		// clock outputs
 		inline bool bclk() { return m_bclk.current_edge(); }
 
@@ -347,9 +379,9 @@ class es5506_core : public es550x_shared_core
 		inline s32 voice_rout(u8 voice) { return (voice < 32) ? m_voice[voice].right_out() : 0; }
 
 	protected:
-		virtual inline u8 max_voices() override { return 32; }
+		void voice_tick();
 
-		virtual void voice_tick() override;
+		virtual u64 clock_edges() override;
 
 	private:
 		std::array<voice_t, 32> m_voice;  // 32 voices
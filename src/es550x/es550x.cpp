@@ -80,11 +80,81 @@ void es550x_shared_core::reset()
 	m_clkin.reset();
 	m_cas.reset();
 	m_e.reset();
+	m_scope.reset();
 }
 
-void es550x_shared_core::es550x_voice_t::reset()
+void es550x_shared_core::serialize(serializer_t &s)
+{
+	m_host_intf.serialize(s);
+	s.item(m_ha);
+	s.item(m_hd);
+	s.item(m_page);
+	m_irqv.serialize(s);
+	s.item(m_active);
+	s.item(m_voice_cycle);
+	s.item(m_voice_fetch);
+	s.item(m_voice_update);
+	s.item(m_voice_end);
+	m_clkin.serialize(s);
+	m_cas.serialize(s);
+	m_e.serialize(s);
+}
+
+// Instrumentation
+es550x_shared_core::stats_t es550x_shared_core::stats()
+{
+	stats_t ret = m_stats;
+	ret.edge.inc(clock_edges());
+	return ret;
+}
+
+void es550x_shared_core::reset_stats()
+{
+	m_stats.reset();
+	m_clkin.reset_toggles();
+	m_cas.reset_toggles();
+	m_e.reset_toggles();
+}
+
+u64 es550x_shared_core::clock_edges()
+{
+	return m_clkin.toggles() + m_cas.toggles() + m_e.toggles();
+}
+
+template<u8 Integer, u8 Fraction, bool Transwave>
+void es550x_shared_core::es550x_voice_t<Integer, Fraction, Transwave>::reset()
 {
 	m_cr.reset();
 	m_alu.reset();
 	m_filter.reset();
+	m_idle = false;
+}
+
+template<u8 Integer, u8 Fraction, bool Transwave>
+void es550x_shared_core::es550x_voice_t<Integer, Fraction, Transwave>::serialize(serializer_t &s)
+{
+	m_cr.serialize(s);
+	m_alu.serialize(s);
+	m_filter.serialize(s);
+	s.item(m_idle);
 }
+
+// Filter execute, returns true if stopped voice is reached to fixed point
+template<u8 Integer, u8 Fraction, bool Transwave>
+bool es550x_shared_core::es550x_voice_t<Integer, Fraction, Transwave>::filter_exec()
+{
+	if (m_alu.busy())
+	{
+		m_filter.tick(m_alu.interpolation());
+		return false;
+	}
+
+	// Input is constant while voice is stopped, so filter is settled if storage is unchanged
+	const std::array<std::array<s32, 2>, 5> prev = m_filter.o();
+	m_filter.tick(m_alu.interpolation());
+	return m_filter.o() == prev;
+}
+
+// Voice configurations
+template class es550x_shared_core::es550x_voice_t<20, 9, false>;  // ES5504, ES5505
+template class es550x_shared_core::es550x_voice_t<21, 11, true>;  // ES5506
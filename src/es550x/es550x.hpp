@@ -67,6 +67,12 @@ class es550x_shared_core : public vgsound_emu_core
 					m_irqb	= 1;
 				}
 
+				void serialize(serializer_t &s)
+				{
+					m_voice = s.value<u8>(m_voice);
+					m_irqb	= s.value<u8>(m_irqb);
+				}
+
 				// setter
 				void set(u8 index)
 				{
@@ -91,371 +97,406 @@ class es550x_shared_core : public vgsound_emu_core
 				u8 m_irqb  : 1;
 		};
 
-		// Common voice class
-		class es550x_voice_t : public vgsound_emu_core
+		// Common control bits
+		class es550x_control_t : public vgsound_emu_core
 		{
-			private:
-				// Common control bits
-				class es550x_control_t : public vgsound_emu_core
+			public:
+				es550x_control_t()
+					: vgsound_emu_core("es550x_voice_control")
+					, m_ca(0)
+					, m_adc(0)
+					, m_bs(0)
+					, m_cmpd(0)
 				{
-					public:
-						es550x_control_t()
-							: vgsound_emu_core("es550x_voice_control")
-							, m_ca(0)
-							, m_adc(0)
-							, m_bs(0)
-							, m_cmpd(0)
-						{
-						}
+				}
 
-						void reset()
-						{
-							m_ca   = 0;
-							m_adc  = 0;
-							m_bs   = 0;
-							m_cmpd = 0;
-						}
+				void reset()
+				{
+					m_ca   = 0;
+					m_adc  = 0;
+					m_bs   = 0;
+					m_cmpd = 0;
+				}
 
-						// setters
-						inline void set_ca(u8 ca) { m_ca = ca & 0xf; }
+				void serialize(serializer_t &s)
+				{
+					m_ca   = s.value<u8>(m_ca);
+					m_adc  = s.value<u8>(m_adc);
+					m_bs   = s.value<u8>(m_bs);
+					m_cmpd = s.value<u8>(m_cmpd);
+				}
 
-						inline void set_adc(bool adc) { m_adc = adc ? 1 : 0; }
+				// setters
+				inline void set_ca(u8 ca) { m_ca = ca & 0xf; }
 
-						inline void set_bs(u8 bs) { m_bs = bs & 0x3; }
+				inline void set_adc(bool adc) { m_adc = adc ? 1 : 0; }
 
-						inline void set_cmpd(bool cmpd) { m_cmpd = cmpd ? 1 : 0; }
+				inline void set_bs(u8 bs) { m_bs = bs & 0x3; }
 
-						// getters
-						inline u8 ca() { return m_ca; }
+				inline void set_cmpd(bool cmpd) { m_cmpd = cmpd ? 1 : 0; }
 
-						inline bool adc() { return m_adc; }
+				// getters
+				inline u8 ca() { return m_ca; }
 
-						inline u8 bs() { return m_bs; }
+				inline bool adc() { return m_adc; }
 
-						inline bool cmpd() { return m_cmpd; }
+				inline u8 bs() { return m_bs; }
 
-					protected:
-						// Channel assign -
-						// 4 bit (16 channel or Bank) for ES5504
-						// 2 bit (4 stereo channels) for ES5505
-						// 3 bit (6 stereo channels) for ES5506
-						u8 m_ca : 4;
+				inline bool cmpd() { return m_cmpd; }
 
-						// ES5504 Specific
-						u8 m_adc : 1;  // Start ADC
+			protected:
+				// Channel assign -
+				// 4 bit (16 channel or Bank) for ES5504
+				// 2 bit (4 stereo channels) for ES5505
+				// 3 bit (6 stereo channels) for ES5506
+				u8 m_ca : 4;
+
+				// ES5504 Specific
+				u8 m_adc : 1;  // Start ADC
+
+				// ES5505/ES5506 Specific
+				u8 m_bs	  : 2;	// Bank bit (1 bit for ES5505, 2 bit for ES5506)
+				u8 m_cmpd : 1;	// Use compressed sample format (ES5506)
+		};
 
-						// ES5505/ES5506 Specific
-						u8 m_bs	  : 2;	// Bank bit (1 bit for ES5505, 2 bit for ES5506)
-						u8 m_cmpd : 1;	// Use compressed sample format (ES5506)
-				};
+		// Accumulator, bit widths are fixed for each chip
+		// 20 integer, 9 fraction for ES5504/ES5505
+		// 21 integer, 11 fraction with transwave for ES5506
+		template<u8 Integer, u8 Fraction, bool Transwave>
+		class es550x_alu_t : public vgsound_emu_core
+		{
+			public:
+				es550x_alu_t()
+					: vgsound_emu_core("es550x_voice_alu")
+					, m_fc(0)
+					, m_start(0)
+					, m_end(0)
+					, m_accum(0)
+					, m_sample({0})
+				{
+				}
+
+				// configurations
+				static constexpr u8 m_integer	   = Integer;
+				static constexpr u8 m_fraction	   = Fraction;
+				static constexpr u8 m_total_bits   = Integer + Fraction;
+				static constexpr u32 m_accum_mask  = u32((u64(1) << (Integer + Fraction)) - 1);
+				static constexpr bool m_transwave  = Transwave;
+				static constexpr u8 m_interp_shift = (Fraction > 9) ? (Fraction - 9) : 0;
+
+				// internal states
+				void reset();
+				bool tick();
+				void serialize(serializer_t &s);
+
+				void loop_exec();
+
+				inline bool busy() { return m_cr.stop() == 0; }
 
-				// Accumulator
-				class es550x_alu_t : public vgsound_emu_core
+				// SF = S1 + ACCfr * (S2 - S1)
+				inline s32 interpolation()
 				{
-					public:
-						es550x_alu_t(u8 integer, u8 fraction, bool transwave)
-							: vgsound_emu_core("es550x_voice_alu")
-							, m_integer(integer)
-							, m_fraction(fraction)
-							, m_total_bits(integer + fraction)
-							, m_accum_mask(
-								u32(std::min<u64>(~0, u64(u64(1) << u64(integer + fraction)) - 1)))
-							, m_transwave(transwave)
-							, m_fc(0)
-							, m_start(0)
-							, m_end(0)
-							, m_accum(0)
-							, m_sample({0})
-						{
-						}
+					const s32 frac = bitfield<s32>(m_accum, m_interp_shift, 9);
+					return m_sample[0] + ((frac * (m_sample[1] - m_sample[0])) >> 9);
+				}
 
-						// configurations
-						const u8 m_integer;
-						const u8 m_fraction;
-						const u8 m_total_bits;
-						const u32 m_accum_mask;
-						const bool m_transwave;
+				inline u32 get_accum_integer() { return bitfield(m_accum, m_fraction, m_integer); }
 
-						// internal states
-						void reset();
-						bool tick();
+				void irq_exec(es550x_intf &intf, es550x_irq_t &irqv, u8 index);
 
-						void loop_exec();
-						bool busy();
-						s32 interpolation();
-						u32 get_accum_integer();
+				void irq_update(es550x_intf &intf, es550x_irq_t &irqv)
+				{
+					intf.irqb(irqv.irqb() ? false : true);
+				}
 
-						void irq_exec(es550x_intf &intf, es550x_irq_t &irqv, u8 index);
+				// setters
+				inline void set_stop0(bool stop0) { m_cr.set_stop0(stop0); }
 
-						void irq_update(es550x_intf &intf, es550x_irq_t &irqv)
-						{
-							intf.irqb(irqv.irqb() ? false : true);
-						}
+				inline void set_stop1(bool stop1) { m_cr.set_stop1(stop1); }
 
-						// setters
-						inline void set_stop0(bool stop0) { m_cr.set_stop0(stop0); }
+				inline void set_lpe(bool lpe) { m_cr.set_lpe(lpe); }
+
+				inline void set_ble(bool ble) { m_cr.set_ble(ble); }
+
+				inline void set_irqe(bool irqe) { m_cr.set_irqe(irqe); }
+
+				inline void set_dir(bool dir) { m_cr.set_dir(dir); }
+
+				inline void set_irq(bool irq) { m_cr.set_irq(irq); }
+
+				inline void set_lei(bool lei) { m_cr.set_lei(lei); }
+
+				inline void set_stop(u8 stop) { m_cr.set_stop(stop); }
+
+				inline void set_loop(u8 loop) { m_cr.set_loop(loop); }
+
+				inline void set_fc(u32 fc) { m_fc = fc; }
+
+				inline void set_start(u32 start, u32 mask = ~0)
+				{
+					m_start = (m_start & ~mask) | (start & mask);
+				}
+
+				inline void set_end(u32 end, u32 mask = ~0)
+				{
+					m_end = (m_end & ~mask) | (end & mask);
+				}
+
+				inline void set_accum(u32 accum, u32 mask = ~0)
+				{
+					m_accum = (m_accum & ~mask) | (accum & mask);
+				}
+
+				inline void set_sample(u8 slot, s32 sample) { m_sample[slot & 1] = sample; }
+
+				// getters
+				inline bool stop0() { return m_cr.stop0(); }
+
+				inline bool stop1() { return m_cr.stop1(); }
 
-						inline void set_stop1(bool stop1) { m_cr.set_stop1(stop1); }
+				inline bool lpe() { return m_cr.lpe(); }
 
-						inline void set_lpe(bool lpe) { m_cr.set_lpe(lpe); }
+				inline bool ble() { return m_cr.ble(); }
 
-						inline void set_ble(bool ble) { m_cr.set_ble(ble); }
+				inline bool irqe() { return m_cr.irqe(); }
 
-						inline void set_irqe(bool irqe) { m_cr.set_irqe(irqe); }
+				inline bool dir() { return m_cr.dir(); }
 
-						inline void set_dir(bool dir) { m_cr.set_dir(dir); }
+				inline bool irq() { return m_cr.irq(); }
 
-						inline void set_irq(bool irq) { m_cr.set_irq(irq); }
+				inline bool lei() { return m_cr.lei(); }
 
-						inline void set_lei(bool lei) { m_cr.set_lei(lei); }
+				inline u8 stop() { return m_cr.stop(); }
 
-						inline void set_stop(u8 stop) { m_cr.set_stop(stop); }
+				inline u8 loop() { return m_cr.loop(); }
 
-						inline void set_loop(u8 loop) { m_cr.set_loop(loop); }
+				inline u32 fc() { return m_fc; }
 
-						inline void set_fc(u32 fc) { m_fc = fc; }
+				inline u32 start() { return m_start; }
 
-						inline void set_start(u32 start, u32 mask = ~0)
+				inline u32 end() { return m_end; }
+
+				inline u32 accum() { return m_accum; }
+
+				inline s32 sample(u8 slot) { return m_sample[slot & 1]; }
+
+			private:
+				class es550x_alu_cr_t : public vgsound_emu_core
+				{
+					public:
+						es550x_alu_cr_t()
+							: vgsound_emu_core("es550x_voice_alu_cr")
+							, m_stop0(0)
+							, m_stop1(0)
+							, m_lpe(0)
+							, m_ble(0)
+							, m_irqe(0)
+							, m_dir(0)
+							, m_irq(0)
+							, m_lei(0)
 						{
-							m_start = (m_start & ~mask) | (start & mask);
 						}
 
-						inline void set_end(u32 end, u32 mask = ~0)
+						void reset()
 						{
-							m_end = (m_end & ~mask) | (end & mask);
+							m_stop0 = 0;
+							m_stop1 = 0;
+							m_lpe	= 0;
+							m_ble	= 0;
+							m_irqe	= 0;
+							m_dir	= 0;
+							m_irq	= 0;
+							m_lei	= 0;
 						}
 
-						inline void set_accum(u32 accum, u32 mask = ~0)
+						void serialize(serializer_t &s)
 						{
-							m_accum = (m_accum & ~mask) | (accum & mask);
+							m_stop0 = s.value<u8>(m_stop0);
+							m_stop1 = s.value<u8>(m_stop1);
+							m_lpe	= s.value<u8>(m_lpe);
+							m_ble	= s.value<u8>(m_ble);
+							m_irqe	= s.value<u8>(m_irqe);
+							m_dir	= s.value<u8>(m_dir);
+							m_irq	= s.value<u8>(m_irq);
+							m_lei	= s.value<u8>(m_lei);
 						}
 
-						inline void set_sample(u8 slot, s32 sample) { m_sample[slot & 1] = sample; }
+						// setters
+						inline void set_stop0(bool stop0) { m_stop0 = stop0 ? 1 : 0; }
+
+						inline void set_stop1(bool stop1) { m_stop1 = stop1 ? 1 : 0; }
 
-						// getters
-						inline bool stop0() { return m_cr.stop0(); }
+						inline void set_lpe(bool lpe) { m_lpe = lpe ? 1 : 0; }
 
-						inline bool stop1() { return m_cr.stop1(); }
+						inline void set_ble(bool ble) { m_ble = ble ? 1 : 0; }
 
-						inline bool lpe() { return m_cr.lpe(); }
+						inline void set_irqe(bool irqe) { m_irqe = irqe ? 1 : 0; }
 
-						inline bool ble() { return m_cr.ble(); }
+						inline void set_dir(bool dir) { m_dir = dir ? 1 : 0; }
 
-						inline bool irqe() { return m_cr.irqe(); }
+						inline void set_irq(bool irq) { m_irq = irq ? 1 : 0; }
 
-						inline bool dir() { return m_cr.dir(); }
+						inline void set_lei(bool lei) { m_lei = lei ? 1 : 0; }
+
+						inline void set_stop(u8 stop)
+						{
+							m_stop0 = (stop >> 0) & 1;
+							m_stop1 = (stop >> 1) & 1;
+						}
 
-						inline bool irq() { return m_cr.irq(); }
+						inline void set_loop(u8 loop)
+						{
+							m_lpe = (loop >> 0) & 1;
+							m_ble = (loop >> 1) & 1;
+						}
 
-						inline bool lei() { return m_cr.lei(); }
+						// getters
+						inline bool stop0() { return m_stop0; }
 
-						inline u8 stop() { return m_cr.stop(); }
+						inline bool stop1() { return m_stop1; }
 
-						inline u8 loop() { return m_cr.loop(); }
+						inline bool lpe() { return m_lpe; }
 
-						inline u32 fc() { return m_fc; }
+						inline bool ble() { return m_ble; }
 
-						inline u32 start() { return m_start; }
+						inline bool irqe() { return m_irqe; }
 
-						inline u32 end() { return m_end; }
+						inline bool dir() { return m_dir; }
 
-						inline u32 accum() { return m_accum; }
+						inline bool irq() { return m_irq; }
 
-						inline s32 sample(u8 slot) { return m_sample[slot & 1]; }
+						inline bool lei() { return m_lei; }
+
+						inline u8 stop() { return (m_stop0 << 0) | (m_stop1 << 1); }
+
+						inline u8 loop() { return (m_lpe << 0) | (m_ble << 1); }
 
 					private:
-						class es550x_alu_cr_t : public vgsound_emu_core
-						{
-							public:
-								es550x_alu_cr_t()
-									: vgsound_emu_core("es550x_voice_alu_cr")
-									, m_stop0(0)
-									, m_stop1(0)
-									, m_lpe(0)
-									, m_ble(0)
-									, m_irqe(0)
-									, m_dir(0)
-									, m_irq(0)
-									, m_lei(0)
-								{
-								}
-
-								void reset()
-								{
-									m_stop0 = 0;
-									m_stop1 = 0;
-									m_lpe	= 0;
-									m_ble	= 0;
-									m_irqe	= 0;
-									m_dir	= 0;
-									m_irq	= 0;
-									m_lei	= 0;
-								}
-
-								// setters
-								inline void set_stop0(bool stop0) { m_stop0 = stop0 ? 1 : 0; }
-
-								inline void set_stop1(bool stop1) { m_stop1 = stop1 ? 1 : 0; }
-
-								inline void set_lpe(bool lpe) { m_lpe = lpe ? 1 : 0; }
-
-								inline void set_ble(bool ble) { m_ble = ble ? 1 : 0; }
-
-								inline void set_irqe(bool irqe) { m_irqe = irqe ? 1 : 0; }
-
-								inline void set_dir(bool dir) { m_dir = dir ? 1 : 0; }
-
-								inline void set_irq(bool irq) { m_irq = irq ? 1 : 0; }
-
-								inline void set_lei(bool lei) { m_lei = lei ? 1 : 0; }
-
-								inline void set_stop(u8 stop)
-								{
-									m_stop0 = (stop >> 0) & 1;
-									m_stop1 = (stop >> 1) & 1;
-								}
-
-								inline void set_loop(u8 loop)
-								{
-									m_lpe = (loop >> 0) & 1;
-									m_ble = (loop >> 1) & 1;
-								}
-
-								// getters
-								inline bool stop0() { return m_stop0; }
-
-								inline bool stop1() { return m_stop1; }
-
-								inline bool lpe() { return m_lpe; }
-
-								inline bool ble() { return m_ble; }
-
-								inline bool irqe() { return m_irqe; }
-
-								inline bool dir() { return m_dir; }
-
-								inline bool irq() { return m_irq; }
-
-								inline bool lei() { return m_lei; }
-
-								inline u8 stop() { return (m_stop0 << 0) | (m_stop1 << 1); }
-
-								inline u8 loop() { return (m_lpe << 0) | (m_ble << 1); }
-
-							private:
-								u8 m_stop0 : 1;	 // Stop with ALU
-								u8 m_stop1 : 1;	 // Stop with processor
-								u8 m_lpe   : 1;	 // Loop enable
-								u8 m_ble   : 1;	 // Bidirectional loop enable
-								u8 m_irqe  : 1;	 // IRQ enable
-								u8 m_dir   : 1;	 // Playback direction
-								u8 m_irq   : 1;	 // IRQ bit
-								u8 m_lei   : 1;	 // Loop end ignore (ES5506 specific)
-						};
-
-						es550x_alu_cr_t m_cr;
-						// Frequency -
-						// 6 integer, 9 fraction for ES5504/ES5505
-						// 6 integer, 11 fraction for ES5506
-						u32 m_fc	= 0;
-						u32 m_start = 0;  // Start register
-						u32 m_end	= 0;  // End register
-
-						// Accumulator -
-						// 20 integer, 9 fraction for ES5504/ES5505
-						// 21 integer, 11 fraction for ES5506
-						u32 m_accum = 0;
-						// Samples
-						std::array<s32, 2> m_sample = {0};
+						u8 m_stop0 : 1;	 // Stop with ALU
+						u8 m_stop1 : 1;	 // Stop with processor
+						u8 m_lpe   : 1;	 // Loop enable
+						u8 m_ble   : 1;	 // Bidirectional loop enable
+						u8 m_irqe  : 1;	 // IRQ enable
+						u8 m_dir   : 1;	 // Playback direction
+						u8 m_irq   : 1;	 // IRQ bit
+						u8 m_lei   : 1;	 // Loop end ignore (ES5506 specific)
 				};
 
-				// Filter
-				class es550x_filter_t : public vgsound_emu_core
+				es550x_alu_cr_t m_cr;
+				// Frequency -
+				// 6 integer, 9 fraction for ES5504/ES5505
+				// 6 integer, 11 fraction for ES5506
+				u32 m_fc	= 0;
+				u32 m_start = 0;  // Start register
+				u32 m_end	= 0;  // End register
+
+				// Accumulator -
+				// 20 integer, 9 fraction for ES5504/ES5505
+				// 21 integer, 11 fraction for ES5506
+				u32 m_accum = 0;
+				// Samples
+				std::array<s32, 2> m_sample = {0};
+		};
+
+		// Filter
+		class es550x_filter_t : public vgsound_emu_core
+		{
+			public:
+				es550x_filter_t()
+					: vgsound_emu_core("es550x_voice_filter")
+					, m_lp(0)
+					, m_k2(0)
+					, m_k1(0)
 				{
-					public:
-						es550x_filter_t()
-							: vgsound_emu_core("es550x_voice_filter")
-							, m_lp(0)
-							, m_k2(0)
-							, m_k1(0)
-						{
-							for (std::array<s32, 2> &elem : m_o)
-							{
-								std::fill(elem.begin(), elem.end(), 0);
-							}
-						}
+					for (std::array<s32, 2> &elem : m_o)
+					{
+						std::fill(elem.begin(), elem.end(), 0);
+					}
+				}
 
-						void reset();
-						void tick(s32 in);
+				void reset();
+				void tick(s32 in);
+				void serialize(serializer_t &s);
 
-						// setters
-						inline void set_lp(u8 lp) { m_lp = lp & 3; }
+				// setters
+				inline void set_lp(u8 lp) { m_lp = lp & 3; }
 
-						inline void set_k2(s32 k2) { m_k2 = k2; }
+				inline void set_k2(s32 k2) { m_k2 = k2; }
 
-						inline void set_k1(s32 k1) { m_k1 = k1; }
+				inline void set_k1(s32 k1) { m_k1 = k1; }
 
-						inline void set_o1_1(s32 o1_1) { m_o[1][0] = o1_1; }
+				inline void set_o1_1(s32 o1_1) { m_o[1][0] = o1_1; }
 
-						inline void set_o2_1(s32 o2_1) { m_o[2][0] = o2_1; }
+				inline void set_o2_1(s32 o2_1) { m_o[2][0] = o2_1; }
 
-						inline void set_o2_2(s32 o2_2) { m_o[2][1] = o2_2; }
+				inline void set_o2_2(s32 o2_2) { m_o[2][1] = o2_2; }
 
-						inline void set_o3_1(s32 o3_1) { m_o[3][0] = o3_1; }
+				inline void set_o3_1(s32 o3_1) { m_o[3][0] = o3_1; }
 
-						inline void set_o3_2(s32 o3_2) { m_o[3][1] = o3_2; }
+				inline void set_o3_2(s32 o3_2) { m_o[3][1] = o3_2; }
 
-						inline void set_o4_1(s32 o4_1) { m_o[4][0] = o4_1; }
+				inline void set_o4_1(s32 o4_1) { m_o[4][0] = o4_1; }
 
-						// getters
-						inline u8 lp() { return m_lp; }
+				// getters
+				inline u8 lp() { return m_lp; }
 
-						inline s32 k2() { return m_k2; }
+				inline s32 k2() { return m_k2; }
 
-						inline s32 k1() { return m_k1; }
+				inline s32 k1() { return m_k1; }
 
-						inline s32 o1_1() { return m_o[1][0]; }
+				inline s32 o1_1() { return m_o[1][0]; }
 
-						inline s32 o2_1() { return m_o[2][0]; }
+				inline s32 o2_1() { return m_o[2][0]; }
 
-						inline s32 o2_2() { return m_o[2][1]; }
+				inline s32 o2_2() { return m_o[2][1]; }
 
-						inline s32 o3_1() { return m_o[3][0]; }
+				inline s32 o3_1() { return m_o[3][0]; }
 
-						inline s32 o3_2() { return m_o[3][1]; }
+				inline s32 o3_2() { return m_o[3][1]; }
 
-						inline s32 o4_1() { return m_o[4][0]; }
+				inline s32 o4_1() { return m_o[4][0]; }
 
-					private:
-						void lp_exec(s32 coeff, s32 in, s32 out);
-						void hp_exec(s32 coeff, s32 in, s32 out);
-
-						// Registers
-						u8 m_lp = 0;  // Filter mode
-						// Filter coefficient registers
-						// 12 bit for filter calculation, 4
-						// LSBs are used for fine control of ramp increment for
-						// hardware envelope (ES5506)
-						s32 m_k2 = 0;  // Filter coefficient 2
-						s32 m_k1 = 0;  // Filter coefficient 1
-
-						// Filter storage registers
-						std::array<std::array<s32, 2>, 5> m_o;
-				};
+				inline std::array<std::array<s32, 2>, 5> &o() { return m_o; }
 
+			private:
+				void lp_exec(s32 coeff, s32 in, s32 out);
+				void hp_exec(s32 coeff, s32 in, s32 out);
+
+				// Registers
+				u8 m_lp = 0;  // Filter mode
+				// Filter coefficient registers
+				// 12 bit for filter calculation, 4
+				// LSBs are used for fine control of ramp increment for
+				// hardware envelope (ES5506)
+				s32 m_k2 = 0;  // Filter coefficient 2
+				s32 m_k1 = 0;  // Filter coefficient 1
+
+				// Filter storage registers
+				std::array<std::array<s32, 2>, 5> m_o;
+		};
+
+		// Common voice class, fetch and tick are defined in voice class of each chip
+		template<u8 Integer, u8 Fraction, bool Transwave>
+		class es550x_voice_t : public vgsound_emu_core
+		{
 			public:
-				es550x_voice_t(std::string tag, u8 integer, u8 fraction, bool transwave)
+				typedef es550x_alu_t<Integer, Fraction, Transwave> alu_t;
+
+				es550x_voice_t(std::string tag)
 					: vgsound_emu_core(tag)
 					, m_cr(es550x_control_t())
-					, m_alu(integer, fraction, transwave)
+					, m_alu()
 					, m_filter(es550x_filter_t())
+					, m_idle(false)
 				{
 				}
 
 				// internal state
-				virtual void reset();
-				virtual void fetch(u8 voice, u8 cycle) = 0;
-				virtual void tick(u8 voice)			   = 0;
+				void reset();
+				void serialize(serializer_t &s);
+
+				// wake up idle voice, must be called when voice registers are touched
+				inline void set_dirty() { m_idle = false; }
 
 				void irq_update(es550x_intf &intf, es550x_irq_t &irqv)
 				{
@@ -465,14 +506,20 @@ class es550x_shared_core : public vgsound_emu_core
 				// Getters
 				es550x_control_t &cr() { return m_cr; }
 
-				es550x_alu_t &alu() { return m_alu; }
+				alu_t &alu() { return m_alu; }
 
 				es550x_filter_t &filter() { return m_filter; }
 
+				inline bool idle() { return m_idle; }
+
 			protected:
+				bool filter_exec();
+
 				es550x_control_t m_cr;
-				es550x_alu_t m_alu;
+				alu_t m_alu;
 				es550x_filter_t m_filter;
+				// Stopped voice with settled filter, skipped until register writes
+				bool m_idle = false;
 		};
 
 		// Host interfaces
@@ -497,6 +544,14 @@ class es550x_shared_core : public vgsound_emu_core
 					m_rw_strobe			 = 0;
 				}
 
+				void serialize(serializer_t &s)
+				{
+					m_host_access		 = s.value<u8>(m_host_access);
+					m_host_access_strobe = s.value<u8>(m_host_access_strobe);
+					m_rw				 = s.value<u8>(m_rw);
+					m_rw_strobe			 = s.value<u8>(m_rw_strobe);
+				}
+
 				// Setters
 				void set_strobe(bool rw)
 				{
@@ -532,6 +587,9 @@ class es550x_shared_core : public vgsound_emu_core
 
 		virtual void tick() {}
 
+		// save state, sample memory isn't included
+		virtual void serialize(serializer_t &s);
+
 		// clock outputs
 		inline bool _cas() { return m_cas.current_edge(); }
 
@@ -559,6 +617,30 @@ class es550x_shared_core : public vgsound_emu_core
 
 		inline bool voice_end() { return m_voice_end; }
 
+		//-----------------------------------------------------------------
+		//
+		//	instrumentation, counted only if VGSOUND_EMU_ENABLE_STATS is defined
+		//
+		//-----------------------------------------------------------------
+
+		typedef core_stats_t<32> stats_t;
+
+		// snapshot of counters, edge counter is summed from clock pulses
+		stats_t stats();
+
+		virtual void reset_stats();
+
+		//-----------------------------------------------------------------
+		//
+		//	per-voice output capture for scope views, disabled by default
+		//	one sample per voice cycle, stereo voices are captured as left + right
+		//
+		//-----------------------------------------------------------------
+
+		typedef voice_scope_t<32> scope_t;
+
+		inline scope_t &scope() { return m_scope; }
+
 	protected:
 		// constructor
 		es550x_shared_core(std::string tag, const u8 voice, es550x_intf &intf)
@@ -578,14 +660,18 @@ class es550x_shared_core : public vgsound_emu_core
 			, m_clkin(clock_pulse_t<s8>(1, 0))
 			, m_cas(clock_pulse_t<s8>(2, 1))
 			, m_e(clock_pulse_t<s8>(4, 0))
+			, m_stats()
+			, m_scope()
 		{
 		}
 
 		// Constants
-		virtual inline u8 max_voices() { return m_max_voices; }
+		inline u8 max_voices() { return m_max_voices; }
 
 		// Shared registers, functions
-		virtual void voice_tick() {}  // voice tick
+		// voice_tick is defined in each chip, and statically called from tick
+
+		virtual u64 clock_edges();	// clock edge toggles for instrumentation
 
 		es550x_intf &m_intf;				// es550x specific memory interface
 		host_interface_flag_t m_host_intf;	// Host interface flag
@@ -607,6 +693,9 @@ class es550x_shared_core : public vgsound_emu_core
 									  // CLKIN trigger this clock
 		clock_pulse_t<s8> m_e;		  // E clock (CLKIN / 8),
 									  // falling edge of CLKIN trigger this clock
+
+		stats_t m_stats;  // instrumentation counters
+		scope_t m_scope;  // per-voice output capture
 };
 
 #endif
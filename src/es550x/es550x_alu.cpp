@@ -11,7 +11,8 @@
 #include "es550x.hpp"
 
 // Accumulator functions
-void es550x_shared_core::es550x_voice_t::es550x_alu_t::reset()
+template<u8 Integer, u8 Fraction, bool Transwave>
+void es550x_shared_core::es550x_alu_t<Integer, Fraction, Transwave>::reset()
 {
 	m_cr.reset();
 	m_fc		= 0;
@@ -21,9 +22,19 @@ void es550x_shared_core::es550x_voice_t::es550x_alu_t::reset()
 	m_sample[0] = m_sample[1] = 0;
 }
 
-bool es550x_shared_core::es550x_voice_t::es550x_alu_t::busy() { return m_cr.stop() == 0; }
+template<u8 Integer, u8 Fraction, bool Transwave>
+void es550x_shared_core::es550x_alu_t<Integer, Fraction, Transwave>::serialize(serializer_t &s)
+{
+	m_cr.serialize(s);
+	s.item(m_fc);
+	s.item(m_start);
+	s.item(m_end);
+	s.item(m_accum);
+	s.item(m_sample);
+}
 
-bool es550x_shared_core::es550x_voice_t::es550x_alu_t::tick()
+template<u8 Integer, u8 Fraction, bool Transwave>
+bool es550x_shared_core::es550x_alu_t<Integer, Fraction, Transwave>::tick()
 {
 	if (m_cr.dir())
 	{
@@ -41,7 +52,8 @@ bool es550x_shared_core::es550x_voice_t::es550x_alu_t::tick()
 		   : false;
 }
 
-void es550x_shared_core::es550x_voice_t::es550x_alu_t::loop_exec()
+template<u8 Integer, u8 Fraction, bool Transwave>
+void es550x_shared_core::es550x_alu_t<Integer, Fraction, Transwave>::loop_exec()
 {
 	if (m_cr.irqe())
 	{  // Set IRQ
@@ -100,22 +112,9 @@ void es550x_shared_core::es550x_voice_t::es550x_alu_t::loop_exec()
 	}
 }
 
-s32 es550x_shared_core::es550x_voice_t::es550x_alu_t::interpolation()
-{
-	// SF = S1 + ACCfr * (S2 - S1)
-	return m_sample[0] + ((bitfield<s32>(m_accum, std::max<s8>(0, m_fraction - 9), 9) *
-						   (m_sample[1] - m_sample[0])) >>
-						  9);
-}
-
-u32 es550x_shared_core::es550x_voice_t::es550x_alu_t::get_accum_integer()
-{
-	return bitfield(m_accum, m_fraction, m_integer);
-}
-
-void es550x_shared_core::es550x_voice_t::es550x_alu_t::irq_exec(es550x_intf &intf,
-																es550x_irq_t &irqv,
-																u8 index)
+template<u8 Integer, u8 Fraction, bool Transwave>
+void es550x_shared_core::es550x_alu_t<Integer, Fraction, Transwave>::irq_exec(
+  es550x_intf &intf, es550x_irq_t &irqv, u8 index)
 {
 	const u8 prev = irqv.irqb();
 	if (m_cr.irq())
@@ -131,3 +130,7 @@ void es550x_shared_core::es550x_voice_t::es550x_alu_t::irq_exec(es550x_intf &int
 		irq_update(intf, irqv);
 	}
 }
+
+// Accumulator configurations
+template class es550x_shared_core::es550x_alu_t<20, 9, false>;	 // ES5504, ES5505
+template class es550x_shared_core::es550x_alu_t<21, 11, true>;	 // ES5506
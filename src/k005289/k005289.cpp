@@ -14,15 +14,37 @@
    update pins.
 
 	Frequency calculation: Input clock / (4096 - Pitch input)
+
+	Bubble System sound generator (k005289_bubble_core):
+
+	Each address output selects 1 of 32 steps of 4 bit waveform PROM, and each
+   voice has 0x100 byte PROM area with 8 selectable waveforms. Waveform select
+   and volume are latched by CPU write, and output is summed after multiply.
+
+	Control latch bits:
+
+	Bits      Description
+	7654 3210
+	xxx- ---- Waveform select
+	---- xxxx Volume
+
+	Output: (Waveform - 8) * Volume
 */
 
 #include "k005289.hpp"
 
 void k005289_core::tick()
 {
-	for (timer_t &elem : m_timer)
+	m_stats.tick.inc();
+	for (u8 v = 0; v < 2; v++)
 	{
-		elem.tick();
+		const u8 addr = m_timer[v].addr();
+		m_timer[v].tick();
+		m_stats.voice[v].tick.inc();
+		if (m_timer[v].addr() < addr)
+		{  // waveform loop
+			m_stats.voice[v].loop.inc();
+		}
 	}
 }
 
@@ -50,3 +72,66 @@ void k005289_core::timer_t::reset()
 	m_freq	  = 0;
 	m_counter = 0;
 }
+
+void k005289_bubble_core::reset()
+{
+	k005289_core::reset();
+	m_volume.fill(0);
+	m_waveform.fill(0);
+	m_render_frac = 0;
+}
+
+// run clocks, returns sum of outputs
+// output is only changed at address update, so it ticks only at events and skips others
+s32 k005289_bubble_core::run(u32 clocks)
+{
+	s32 acc = 0;
+	while (clocks > 0)
+	{
+		const u32 step =
+		  std::min<u32>(clocks, std::min(m_timer[0].carry_delay(), m_timer[1].carry_delay()));
+
+		// skip constant output segment
+		if (step > 1)
+		{
+			const u32 skip = step - 1;
+			acc += out() * skip;
+			m_stats.tick.inc(skip);
+			for (u8 v = 0; v < 2; v++)
+			{
+				m_stats.voice[v].tick.inc(skip);
+				m_timer[v].skip(skip);
+			}
+			clocks -= skip;
+		}
+
+		// address update
+		tick();
+		acc += out();
+		clocks--;
+	}
+	return acc;
+}
+
+void k005289_bubble_core::render(s32 *out, u32 samples, u32 clock, u32 rate)
+{
+	for (u32 s = 0; s < samples; s++)
+	{
+		m_render_frac += clock;
+		const u32 clocks = m_render_frac / rate;
+		m_render_frac %= rate;
+		out[s] = clocks ? ((run(clocks) * 256) / s32(clocks)) : (this->out() * 256);
+	}
+}
+
+void k005289_bubble_core::set_prom(const u8 *prom)
+{
+	std::copy(prom, prom + 0x200, m_prom.begin());
+}
+
+void k005289_bubble_core::control_w(int voice, u8 data)
+{
+	m_stats.access.inc();
+	m_volume[voice & 1]	  = bitfield(data, 0, 4);
+	m_waveform[voice & 1] = bitfield(data, 5, 3);
+}
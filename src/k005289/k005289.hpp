@@ -17,7 +17,7 @@
 
 class k005289_core : public vgsound_emu_core
 {
-	private:
+	protected:
 		// k005289 timer classes
 		class timer_t : public vgsound_emu_core
 		{
@@ -35,6 +35,11 @@ class k005289_core : public vgsound_emu_core
 				void reset();
 				void tick();
 
+				// event skipping
+				inline u32 carry_delay() { return 0x1000 - bitfield(m_counter, 0, 12); }
+
+				inline void skip(u32 clocks) { m_counter += clocks; }
+
 				// accessors
 				// Replace current frequency to lastest loaded pitch
 				inline void update() { m_freq = m_pitch; }
@@ -56,30 +61,99 @@ class k005289_core : public vgsound_emu_core
 
 	public:
 		// constructor
-		k005289_core()
-			: vgsound_emu_core("k005289")
+		k005289_core(std::string tag = "k005289")
+			: vgsound_emu_core(tag)
 			, m_timer{timer_t()}
+			, m_stats()
 		{
 		}
 
+		// destructor
+		virtual ~k005289_core() {}
+
 		// internal state
-		void reset();
+		virtual void reset();
 		void tick();
 
 		// accessors
 		// TG1/2 pin
-		inline void update(int voice) { m_timer[voice & 1].update(); }
+		inline void update(int voice)
+		{
+			m_stats.access.inc();
+			m_timer[voice & 1].update();
+		}
 
 		// setters
 		// LD1/2 pin, A0...11 pin
-		inline void load(int voice, u16 addr) { m_timer[voice & 1].load(addr); }
+		inline void load(int voice, u16 addr)
+		{
+			m_stats.access.inc();
+			m_timer[voice & 1].load(addr);
+		}
 
 		// getters
 		// 1QA...E/2QA...E pin
 		inline u8 addr(int voice) { return m_timer[voice & 1].addr(); }
 
-	private:
+		// instrumentation, counted only if VGSOUND_EMU_ENABLE_STATS is defined
+		typedef core_stats_t<2> stats_t;
+
+		inline const stats_t &stats() { return m_stats; }
+
+		inline void reset_stats() { m_stats.reset(); }
+
+	protected:
 		std::array<timer_t, 2> m_timer;
+
+		stats_t m_stats;  // instrumentation counters
+};
+
+// Bubble System sound generator with waveform PROM and latches
+class k005289_bubble_core : public k005289_core
+{
+	public:
+		// constructor
+		k005289_bubble_core()
+			: k005289_core("k005289_bubble")
+			, m_prom{0}
+			, m_volume{0}
+			, m_waveform{0}
+			, m_render_frac(0)
+		{
+		}
+
+		// internal state
+		virtual void reset() override;
+
+		// render output into buffer at host rate, each sample is averaged output of clock / rate
+		// ticks in 8 bit fraction
+		void render(s32 *out, u32 samples, u32 clock, u32 rate);
+
+		// setters
+		// Waveform PROM, 0x100 bytes for each voice
+		void set_prom(const u8 *prom);
+
+		// Volume and waveform select latch
+		void control_w(int voice, u8 data);
+
+		// getters
+		// output for each voices, signed 4 bit waveform * 4 bit volume
+		inline s32 voice_out(int voice)
+		{
+			voice &= 1;
+			const u8 data = m_prom[(voice << 8) | (m_waveform[voice] << 5) | addr(voice)];
+			return (bitfield<s32>(data, 0, 4) - 8) * m_volume[voice];
+		}
+
+		inline s32 out() { return voice_out(0) + voice_out(1); }
+
+	private:
+		s32 run(u32 clocks);
+
+		std::array<u8, 0x200> m_prom = {0};	 // Waveform PROM
+		std::array<u8, 2> m_volume	 = {0};	 // Volume latch
+		std::array<u8, 2> m_waveform = {0};	 // Waveform select latch
+		u32 m_render_frac			 = 0;	 // fraction of clock / rate for render
 };
 
 #endif
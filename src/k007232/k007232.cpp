@@ -65,6 +65,7 @@
 
 void k007232_core::tick()
 {
+	m_stats.tick.inc();
 	for (int i = 0; i < 2; i++)
 	{
 		m_voice[i].tick(i);
@@ -73,6 +74,7 @@ void k007232_core::tick()
 
 void k007232_core::voice_t::tick(u8 ne)
 {
+	m_host.m_stats.voice[ne].tick.inc();
 	if (m_busy)
 	{
 		const bool is4bit = bitfield(m_pitch, 13);	// 4 bit frequency divider flag
@@ -109,9 +111,10 @@ void k007232_core::voice_t::tick(u8 ne)
 			}
 		}
 
-		m_data = m_host.m_intf.read_sample(ne, bitfield(m_addr, 0, 17));  // fetch ROM
-		if (bitfield(m_data, 7))										  // check end marker
+		m_data = m_host.read_sample(ne, bitfield(m_addr, 0, 17));  // fetch ROM
+		if (bitfield(m_data, 7))								   // check end marker
 		{
+			m_host.m_stats.voice[ne].loop.inc();
 			if (m_loop)
 			{
 				m_addr = m_start;
@@ -126,12 +129,146 @@ void k007232_core::voice_t::tick(u8 ne)
 	}
 	else
 	{
+		m_host.m_stats.voice[ne].idle.inc();
 		m_out = 0;
 	}
 }
 
+// stopped voice is changed only by register writes
+bool k007232_core::idle() { return (!m_voice[0].busy()) && (!m_voice[1].busy()); }
+
+void k007232_core::skip_idle(u64 ticks)
+{
+	if (ticks == 0)
+	{
+		return;
+	}
+
+	m_stats.tick.inc(ticks);
+	for (voice_t &elem : m_voice)
+	{
+		elem.skip_idle();
+	}
+}
+
+// same as tick but for whole block
+// output is only changed at counter carry or end marker, so it's filled until next event
+void k007232_core::render(s32 **out, u32 samples)
+{
+	m_stats.tick.inc(samples);
+	for (int i = 0; i < 2; i++)
+	{
+		if (out[i] != nullptr)
+		{
+			m_voice[i].render(i, out[i], samples);
+		}
+		else
+		{
+			for (u32 s = 0; s < samples; s++)
+			{
+				m_voice[i].tick(i);
+			}
+		}
+	}
+}
+
+void k007232_core::voice_t::render(u8 ne, s32 *out, u32 samples)
+{
+	voice_stats_t &stats = m_host.m_stats.voice[ne];
+	u32 s				 = 0;
+	while (s < samples)
+	{
+		if (!m_busy)
+		{
+			stats.tick.inc(samples - s);
+			stats.idle.inc(samples - s);
+			m_out = 0;
+			std::fill(out + s, out + samples, 0);
+			return;
+		}
+
+		const u32 delay = carry_delay();
+		if (delay > 1)
+		{
+			// hold current data until next carry
+			const u8 data = m_host.read_sample(ne, bitfield(m_addr, 0, 17));
+			if (!bitfield(data, 7))
+			{
+				const u32 run = std::min<u32>(delay - 1, samples - s);
+				m_data		  = data;
+				m_out		  = s8(m_data) - 0x40;
+				std::fill(out + s, out + s + run, m_out);
+				stats.tick.inc(run);
+				skip(run);
+				s += run;
+				continue;
+			}
+		}
+		else if ((!bitfield(m_pitch, 13)) && m_host.m_rom[ne].valid())
+		{
+			// stream samples between carries until end marker, linear address only
+			const u32 first	 = bitfield(m_addr + 1, 0, 17);
+			const u32 count	 = m_host.next_end(ne, first) - first;
+			const u16 reload = bitfield(m_pitch, 0, 12);
+			const u32 period =
+			  bitfield(m_pitch, 12) ? (0x100 - bitfield(reload, 0, 8)) : (0x1000 - reload);
+			for (u32 i = 0; (i < count) && (s < samples); i++)
+			{
+				const u32 run = std::min<u32>(period, samples - s);
+				m_counter	  = reload;
+				m_addr		  = first + i;
+				m_data		  = m_host.m_rom[ne].read_byte(m_addr);
+				m_out		  = s8(m_data) - 0x40;
+				std::fill(out + s, out + s + run, m_out);
+				stats.tick.inc(run);
+				stats.direct.inc();
+				skip(run - 1);
+				s += run;
+			}
+			if (count > 0)
+			{
+				continue;
+			}
+		}
+
+		// carry, end marker
+		tick(ne);
+		out[s++] = m_out;
+	}
+}
+
+// clocks until next carry includes carry itself
+u32 k007232_core::voice_t::carry_delay()
+{
+	if (bitfield(m_pitch, 12))
+	{
+		return 0x100 - bitfield(m_counter, 0, 8);
+	}
+	else if (bitfield(m_pitch, 13))
+	{
+		return 0x10 - bitfield(m_counter, 8, 4);
+	}
+	return 0x1000 - bitfield(m_counter, 0, 12);
+}
+
+// skip clocks without carry, clocks must be less than carry_delay()
+void k007232_core::voice_t::skip(u32 clocks)
+{
+	if (bitfield(m_pitch, 13))
+	{
+		const u32 lo = bitfield<u32>(bitfield(m_counter, 0, 8) + clocks, 0, 8);
+		const u32 hi = bitfield<u32>(bitfield(m_counter, 8, 4) + clocks, 0, 4);
+		m_counter	 = (m_counter & ~0xfff) | (hi << 8) | lo;
+	}
+	else
+	{
+		m_counter += clocks;
+	}
+}
+
 void k007232_core::write(u8 address, u8 data)
 {
+	m_stats.access.inc();
 	address &= 0xf;	 // 4 bit for CPU write
 
 	switch (address)
@@ -161,6 +298,46 @@ void k007232_core::write(u8 address, u8 data)
 	}
 
 	m_reg[address] = data;
+	if (address == 0xc)
+	{
+		update_gain();
+	}
+}
+
+void k007232_core::set_pan(u8 voice, u8 left, u8 right)
+{
+	m_lpan[voice & 1] = left;
+	m_rpan[voice & 1] = right;
+	update_gain();
+}
+
+// latch gains from SLEV level and pan
+void k007232_core::update_gain()
+{
+	for (int i = 0; i < 2; i++)
+	{
+		const s32 level = bitfield(m_reg[0xc], i << 2, 4);
+		m_lgain[i]		= level * m_lpan[i];
+		m_rgain[i]		= level * m_rpan[i];
+	}
+}
+
+void k007232_core::render_stereo(s32 *out, u32 samples)
+{
+	std::array<s32, 256> voice0, voice1;
+	s32 *buf[2] = {voice0.data(), voice1.data()};
+	while (samples > 0)
+	{
+		const u32 len = std::min<u32>(samples, 256);
+		render(buf, len);
+		for (u32 i = 0; i < len; i++)
+		{
+			out[(i << 1) + 0] = (voice0[i] * m_lgain[0]) + (voice1[i] * m_lgain[1]);
+			out[(i << 1) + 1] = (voice0[i] * m_rgain[0]) + (voice1[i] * m_rgain[1]);
+		}
+		out += len << 1;
+		samples -= len;
+	}
 }
 
 // write registers on each voices
@@ -197,6 +374,32 @@ void k007232_core::voice_t::keyon()
 	m_addr	  = m_start;
 }
 
+void k007232_core::set_rom(u8 ne, const u8 *rom, u32 size)
+{
+	ne &= 1;
+	m_rom[ne].set(rom, size);
+	m_end[ne].clear();
+	if (m_rom[ne].valid())
+	{
+		// pre-scan end markers in 17 bit address space
+		for (u32 addr = 0; addr < 0x20000; addr++)
+		{
+			if (bitfield(m_rom[ne].read_byte(addr), 7))
+			{
+				m_end[ne].push_back(addr);
+			}
+		}
+	}
+}
+
+// find next end marker position, or end of address space if not exists
+u32 k007232_core::next_end(u8 ne, u32 address)
+{
+	const std::vector<u32> &end = m_end[ne];
+	const auto it				= std::lower_bound(end.begin(), end.end(), address);
+	return (it != end.end()) ? *it : 0x20000;
+}
+
 // reset chip
 void k007232_core::reset()
 {
@@ -208,6 +411,7 @@ void k007232_core::reset()
 	m_intf.write_slev(0);
 
 	std::fill(m_reg.begin(), m_reg.end(), 0);
+	update_gain();
 }
 
 // reset voice
@@ -222,3 +426,29 @@ void k007232_core::voice_t::reset()
 	m_data	  = 0;
 	m_out	  = 0;
 }
+
+void k007232_core::serialize(serializer_t &s)
+{
+	for (auto &elem : m_voice)
+	{
+		elem.serialize(s);
+	}
+
+	s.item(m_reg);
+	s.item(m_lpan);
+	s.item(m_rpan);
+	s.item(m_lgain);
+	s.item(m_rgain);
+}
+
+void k007232_core::voice_t::serialize(serializer_t &s)
+{
+	s.item(m_busy);
+	s.item(m_loop);
+	s.item(m_pitch);
+	s.item(m_start);
+	s.item(m_counter);
+	s.item(m_addr);
+	s.item(m_data);
+	s.item(m_out);
+}
@@ -56,6 +56,8 @@ class k007232_core : public vgsound_emu_core
 				// internal state
 				void reset();
 				void tick(u8 ne);
+				void serialize(serializer_t &s);
+				void render(u8 ne, s32 *out, u32 samples);
 
 				// accessors
 				void write(u8 address, u8 data);
@@ -65,9 +67,18 @@ class k007232_core : public vgsound_emu_core
 				inline void set_loop(bool loop) { m_loop = loop; }
 
 				// getters
+				inline bool busy() { return m_busy; }
+
 				inline s8 out() { return m_out; }
 
+				// stopped voice, output is cleared at next tick
+				inline void skip_idle() { m_out = 0; }
+
 			private:
+				// event skipping
+				u32 carry_delay();
+				void skip(u32 clocks);
+
 				// registers
 				k007232_core &m_host;
 				bool m_busy = false;  // busy status
@@ -88,30 +99,99 @@ class k007232_core : public vgsound_emu_core
 			, m_voice{*this, *this}
 			, m_intf(intf)
 			, m_reg{0}
+			, m_rom{rom_span_t(), rom_span_t()}
+			, m_end{std::vector<u32>(), std::vector<u32>()}
+			, m_lpan{0xff, 0xff}
+			, m_rpan{0xff, 0xff}
+			, m_lgain{0}
+			, m_rgain{0}
+			, m_stats()
 		{
 		}
 
 		// host accessors
-		void keyon(u8 voice) { m_voice[voice & 1].keyon(); }
+		void keyon(u8 voice)
+		{
+			m_stats.access.inc();
+			m_voice[voice & 1].keyon();
+		}
 
 		void write(u8 address, u8 data);
 
+		// direct sample ROM access for each NE, for faster render
+		// ROM is pre-scanned for end markers, must be set again when contents are changed
+		void set_rom(u8 ne, const u8 *rom, u32 size);
+
 		// internal state
 		void reset();
 		void tick();
 
+		// silence detection for auto sleep, true if every voice is stopped
+		bool idle();
+
+		// advance ticks in idle state, same as calling tick() for ticks times
+		void skip_idle(u64 ticks);
+
+		// save state, sample ROM isn't included
+		void serialize(serializer_t &s);
+
+		// render output for each voices into buffers, each sample is single tick
+		// null buffer is allowed for skipping output
+		void render(s32 **out, u32 samples);
+
+		// render interleaved stereo output with built-in level stage
+		// each voice output is multiplied with 4 bit level from SLEV write
+		// (low nibble for voice 0, high nibble for voice 1) and 8 bit host pan
+		void render_stereo(s32 *out, u32 samples);
+
+		// host pan for level stage, 0xff is full volume
+		void set_pan(u8 voice, u8 left, u8 right);
+
 		// output for each voices, ASD/BSD pin
 		inline s32 output(u8 voice) { return m_voice[voice & 1].out(); }
 
 		// getters for debug, trackers, etc
 		inline u8 reg_r(u8 address) { return m_reg[address & 0xf]; }
 
+		// instrumentation, counted only if VGSOUND_EMU_ENABLE_STATS is defined
+		typedef core_stats_t<2> stats_t;
+
+		inline const stats_t &stats() { return m_stats; }
+
+		inline void reset_stats() { m_stats.reset(); }
+
 	private:
+		// sample fetch
+		inline u8 read_sample(u8 ne, u32 address)
+		{
+			if (m_rom[ne].valid())
+			{
+				m_stats.voice[ne].direct.inc();
+				return m_rom[ne].read_byte(address);
+			}
+			m_stats.voice[ne].read.inc();
+			return m_intf.read_sample(ne, address);
+		}
+
+		u32 next_end(u8 ne, u32 address);
+		void update_gain();
+
 		std::array<voice_t, 2> m_voice;
 
 		k007232_intf &m_intf;  // common memory interface
 
 		std::array<u8, 16> m_reg = {0};	 // register pool
+
+		std::array<rom_span_t, 2> m_rom;		// Sample ROM for direct access, per NE
+		std::array<std::vector<u32>, 2> m_end;	// End marker positions of sample ROM
+
+		// level stage
+		std::array<u8, 2> m_lpan   = {0xff, 0xff};	// Left pan
+		std::array<u8, 2> m_rpan   = {0xff, 0xff};	// Right pan
+		std::array<s32, 2> m_lgain = {0};			// Left gain, latched from SLEV and pan
+		std::array<s32, 2> m_rgain = {0};			// Right gain, latched from SLEV and pan
+
+		stats_t m_stats;  // instrumentation counters
 };
 
 #endif
@@ -96,12 +96,13 @@
 
 void k053260_core::tick()
 {
+	m_stats.tick.inc();
 	m_out[0] = m_out[1] = 0;
 	if (m_ctrl.sound_en())
 	{
 		for (int i = 0; i < 4; i++)
 		{
-			m_voice[i].tick();
+			m_voice[i].tick(i);
 			m_out[0] += m_voice[i].out(0);
 			m_out[1] += m_voice[i].out(1);
 		}
@@ -122,8 +123,9 @@ void k053260_core::tick()
 	m_dac.set_clock(bitfield(dac_clock, 0, 4));
 }
 
-void k053260_core::voice_t::tick()
+void k053260_core::voice_t::tick(u8 voice)
 {
+	m_host.m_stats.voice[voice].tick.inc();
 	if (m_enable && m_busy)
 	{
 		bool update = false;
@@ -148,6 +150,7 @@ void k053260_core::voice_t::tick()
 			m_counter = bitfield(m_pitch, 0, 12);
 		}
 		m_data = m_host.m_intf.read_sample(bitfield(m_addr, 0, 21));  // fetch ROM
+		m_host.m_stats.voice[voice].read.inc();
 		if (update)
 		{
 			const u8 nibble = bitfield(m_data, m_bitpos & 4, 4);  // get nibble from ROM
@@ -160,6 +163,7 @@ void k053260_core::voice_t::tick()
 
 		if (m_remain < 0)  // check end flag
 		{
+			m_host.m_stats.voice[voice].loop.inc();
 			if (m_loop)
 			{
 				m_addr		= m_start;
@@ -179,12 +183,62 @@ void k053260_core::voice_t::tick()
 	}
 	else
 	{
+		m_host.m_stats.voice[voice].idle.inc();
 		m_out[0] = m_out[1] = 0;
 	}
 }
 
+// output and YM3012 shift registers are zero, and no voice is playing
+bool k053260_core::idle()
+{
+	if ((m_out[0] != 0) || (m_out[1] != 0) || (!m_ym3012.idle()))
+	{
+		return false;
+	}
+
+	if (m_ctrl.sound_en())
+	{
+		for (voice_t &elem : m_voice)
+		{
+			if (elem.enable() && elem.busy())
+			{
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+void k053260_core::skip_idle(u64 ticks)
+{
+	if (ticks == 0)
+	{
+		return;
+	}
+
+	m_stats.tick.inc(ticks);
+	if (m_ctrl.sound_en())
+	{
+		for (voice_t &elem : m_voice)
+		{
+			elem.skip_idle();
+		}
+	}
+
+	// zero is shifted into YM3012, only DAC clock and state are changed
+	// timer interrupt is written for each DAC step, same as tick()
+	const u64 clock = m_dac.clock() + ticks;
+	for (u64 steps = clock >> 4; steps > 0; steps--)
+	{
+		m_intf.write_int(m_dac.state());
+		m_dac.set_state(u8(bitfield(m_dac.state() + 1, 0, 2)));
+	}
+	m_dac.set_clock(u8(bitfield<u64>(clock, 0, 4)));
+}
+
 u8 k053260_core::read(u8 address)
 {
+	m_stats.access.inc();
 	address &= 0x3f;  // 6 bit for CPU read
 
 	switch (address)
@@ -213,6 +267,7 @@ u8 k053260_core::read(u8 address)
 
 void k053260_core::write(u8 address, u8 data)
 {
+	m_stats.access.inc();
 	address &= 0x3f;  // 6 bit for CPU write
 
 	switch (address)
@@ -376,3 +431,39 @@ void k053260_core::voice_t::reset()
 	m_adpcm_buf = 0;
 	m_out[0] = m_out[1] = 0;
 }
+
+void k053260_core::serialize(serializer_t &s)
+{
+	for (auto &elem : m_voice)
+	{
+		elem.serialize(s);
+	}
+
+	s.item(m_host2snd);
+	s.item(m_snd2host);
+	m_ctrl.serialize(s);
+	m_ym3012.serialize(s);
+	m_dac.serialize(s);
+	s.item(m_reg);
+	s.item(m_out);
+}
+
+void k053260_core::voice_t::serialize(serializer_t &s)
+{
+	m_enable = s.value<u16>(m_enable);
+	m_busy	 = s.value<u16>(m_busy);
+	m_loop	 = s.value<u16>(m_loop);
+	m_adpcm	 = s.value<u16>(m_adpcm);
+	m_pitch	 = s.value<u16>(m_pitch);
+	s.item(m_start);
+	s.item(m_length);
+	s.item(m_volume);
+	s.item(m_pan);
+	s.item(m_counter);
+	s.item(m_addr);
+	s.item(m_remain);
+	s.item(m_bitpos);
+	s.item(m_data);
+	s.item(m_adpcm_buf);
+	s.item(m_out);
+}
@@ -63,7 +63,8 @@ class k053260_core : public vgsound_emu_core
 
 				// internal state
 				void reset();
-				void tick();
+				void tick(u8 voice);
+				void serialize(serializer_t &s);
 
 				// accessors
 				void write(u8 address, u8 data);
@@ -94,6 +95,9 @@ class k053260_core : public vgsound_emu_core
 
 				s32 out(u8 ch) { return m_out[ch & 1]; }
 
+				// stopped voice, output is cleared at next tick
+				void skip_idle() { m_out[0] = m_out[1] = 0; }
+
 			private:
 				// registers
 				k053260_core &m_host;
@@ -139,6 +143,13 @@ class k053260_core : public vgsound_emu_core
 					m_input_en = (data >> 2) & 3;
 				}
 
+				void serialize(serializer_t &s)
+				{
+					m_rom_read = s.value<u8>(m_rom_read);
+					m_sound_en = s.value<u8>(m_sound_en);
+					m_input_en = s.value<u8>(m_input_en);
+				}
+
 				// getters
 				bool rom_read() { return m_rom_read; }
 
@@ -173,6 +184,17 @@ class k053260_core : public vgsound_emu_core
 					m_in[(ch & 1) ^ 1] = in;
 				}
 
+				inline bool idle()
+				{
+					return (m_in[0] == 0) && (m_in[1] == 0) && (m_out[0] == 0) && (m_out[1] == 0);
+				}
+
+				void serialize(serializer_t &s)
+				{
+					s.item(m_in);
+					s.item(m_out);
+				}
+
 			private:
 				std::array<s32, 2> m_in	 = {0};
 				std::array<s32, 2> m_out = {0};
@@ -193,6 +215,12 @@ class k053260_core : public vgsound_emu_core
 					m_state = 0;
 				}
 
+				void serialize(serializer_t &s)
+				{
+					m_clock = s.value<u8>(m_clock);
+					m_state = s.value<u8>(m_state);
+				}
+
 				inline void set_clock(u8 clock) { m_clock = clock; }
 
 				inline void set_state(u8 state) { m_state = state; }
@@ -219,6 +247,7 @@ class k053260_core : public vgsound_emu_core
 			, m_dac(dac_t())
 			, m_reg{0}
 			, m_out{0}
+			, m_stats()
 		{
 		}
 
@@ -235,6 +264,16 @@ class k053260_core : public vgsound_emu_core
 		void reset();
 		void tick();
 
+		// silence detection for auto sleep, true if every voice is stopped and output is settled
+		bool idle();
+
+		// advance ticks in idle state, same as calling tick() for ticks times
+		// DAC clock is still running, timer interrupt is written for each DAC step
+		void skip_idle(u64 ticks);
+
+		// save state, sample ROM isn't included
+		void serialize(serializer_t &s);
+
 		// getters for debug, trackers, etc
 		inline s32 output(u8 ch) { return m_out[ch & 1]; }	// output for each channels
 
@@ -245,6 +284,13 @@ class k053260_core : public vgsound_emu_core
 			return (voice < 4) ? m_voice[voice].out(ch & 1) : 0;
 		}
 
+		// instrumentation, counted only if VGSOUND_EMU_ENABLE_STATS is defined
+		typedef core_stats_t<4> stats_t;
+
+		inline const stats_t &stats() { return m_stats; }
+
+		inline void reset_stats() { m_stats.reset(); }
+
 	private:
 		std::array<voice_t, 4> m_voice;
 		k053260_intf &m_intf;  // common memory interface
@@ -259,6 +305,8 @@ class k053260_core : public vgsound_emu_core
 
 		std::array<u8, 64> m_reg = {0};	 // register pool
 		std::array<s32, 2> m_out = {0};	 // stereo output
+
+		stats_t m_stats;  // instrumentation counters
 };
 
 #endif
@@ -44,6 +44,10 @@
 		 0--x---- Suspend channel 2
 		 0---x--- Suspend channel 1
 
+	Many boards are bank switching sample ROM (NMK112, etc), often with phrase
+   table bank separated from samples. It can be mapped in core with 16 KB pages
+   and phrase table bank, for avoid memory interface call per nibble.
+
 	Frequency calculation:
 	if (SS) then
 		Frequency = Input clock / 165
@@ -56,9 +60,10 @@
 
 void msm6295_core::tick()
 {
+	m_stats.tick.inc();
 	if (m_counter < 4)
 	{
-		m_voice[m_counter].tick();
+		m_voice[m_counter].tick(m_counter);
 		m_out_temp += m_voice[m_counter].out();
 	}
 	if ((++m_counter) >= (m_ss ? 5 : 4))
@@ -122,6 +127,147 @@ void msm6295_core::tick()
 		m_out	   = m_out_temp;
 		m_out_temp = 0;
 		m_counter  = 0;
+		if (m_scope.enabled() && m_scope.capture())
+		{
+			for (u8 v = 0; v < 4; v++)
+			{
+				m_scope.set(v, m_voice[v].out());
+			}
+			m_scope.next();
+		}
+	}
+}
+
+// no voice and command handler event, and output is settled
+bool msm6295_core::idle()
+{
+	if (m_scope.enabled() || m_command_pending || (m_out != 0) || (m_out_temp != 0))
+	{
+		return false;
+	}
+
+	for (auto &elem : m_voice)
+	{
+		if (elem.event_delay() != 0)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+// only round counter is running in idle state
+void msm6295_core::skip_idle(u64 ticks)
+{
+	if (ticks == 0)
+	{
+		return;
+	}
+
+	m_stats.tick.inc(ticks);
+	const u8 div = m_ss ? 5 : 4;
+	if (m_counter >= div)
+	{  // out of range after SS pin change, wrapped at next tick
+		m_counter = 0;
+		ticks--;
+	}
+	m_counter = u16((m_counter + ticks) % div);
+}
+
+// rounds until next command handler event includes event itself, 0 if no event
+u32 msm6295_core::command_delay()
+{
+	if (!m_command_pending)
+	{
+		return 0;
+	}
+
+	// play voice and select phrase are delayed with 15 rounds, suspend is immediately
+	return (bitfield(m_command, 7) || bitfield(m_next_command, 7)) ? (15 - m_clock) : 1;
+}
+
+// run rounds from start of round
+// output is only changed at voice decode or command handler, so others are skipped
+void msm6295_core::run(u32 rounds)
+{
+	const u8 div = m_ss ? 5 : 4;
+	while (rounds > 0)
+	{
+		// rounds until next event
+		u32 step = rounds;
+		for (auto &elem : m_voice)
+		{
+			const u32 delay = elem.event_delay();
+			if (delay)
+			{
+				step = std::min(step, delay);
+			}
+		}
+		const u32 delay = command_delay();
+		if (delay)
+		{
+			step = std::min(step, delay);
+		}
+
+		// skip rounds without event, output is latched as same as tick
+		if (step > 1)
+		{
+			const u32 skip = step - 1;
+			m_out		   = 0;
+			m_stats.tick.inc(skip * div);
+			for (u8 v = 0; v < 4; v++)
+			{
+				m_stats.voice[v].tick.inc(skip);
+				if (!m_voice[v].busy())
+				{
+					m_stats.voice[v].idle.inc(skip);
+				}
+				m_voice[v].skip(skip);
+				m_out += m_voice[v].out();
+				if (m_scope.enabled())
+				{
+					m_scope.fill_block(v, m_voice[v].out(), skip);
+				}
+			}
+			if (m_scope.enabled())
+			{
+				m_scope.next_block(skip);
+			}
+			if (m_command_pending)
+			{
+				m_clock += skip;
+			}
+			rounds -= skip;
+		}
+
+		// event
+		for (u8 i = 0; i < div; i++)
+		{
+			tick();
+		}
+		rounds--;
+	}
+}
+
+void msm6295_core::render(s32 *out, u32 samples)
+{
+	const u8 div = m_ss ? 5 : 4;
+	for (u32 s = 0; s < samples; s++)
+	{
+		u32 ticks = 33 * div;
+		// finish current round
+		while ((m_counter != 0) && (ticks > 0))
+		{
+			tick();
+			ticks--;
+		}
+
+		run(ticks / div);
+		for (u32 i = 0; i < (ticks % div); i++)
+		{
+			tick();
+		}
+		out[s] = m_out;
 	}
 }
 
@@ -139,10 +285,12 @@ void msm6295_core::reset()
 	m_counter		  = 0;
 	m_out			  = 0;
 	m_out_temp		  = 0;
+	m_scope.reset();
 }
 
-void msm6295_core::voice_t::tick()
+void msm6295_core::voice_t::tick(u8 voice)
 {
+	m_host.m_stats.voice[voice].tick.inc();
 	if (!m_busy)
 	{
 		if (bitfield(m_command, 7))
@@ -150,18 +298,22 @@ void msm6295_core::voice_t::tick()
 			// get phrase header (stored in data memory)
 			const u32 phrase = bitfield(m_command, 0, 7) << 3;
 			// Start address
-			m_addr = (bitfield(m_host.m_intf.read_byte(phrase | 0), 0, 2) << 16) |
-					 (m_host.m_intf.read_byte(phrase | 1) << 8) |
-					 (m_host.m_intf.read_byte(phrase | 2) << 0);
+			m_addr = (bitfield(m_host.read_phrase(voice, phrase | 0), 0, 2) << 16) |
+					 (m_host.read_phrase(voice, phrase | 1) << 8) |
+					 (m_host.read_phrase(voice, phrase | 2) << 0);
 			// End address
-			m_end = (bitfield(m_host.m_intf.read_byte(phrase | 3), 0, 2) << 16) |
-					(m_host.m_intf.read_byte(phrase | 4) << 8) |
-					(m_host.m_intf.read_byte(phrase | 5) << 0);
+			m_end = (bitfield(m_host.read_phrase(voice, phrase | 3), 0, 2) << 16) |
+					(m_host.read_phrase(voice, phrase | 4) << 8) |
+					(m_host.read_phrase(voice, phrase | 5) << 0);
 			m_nibble  = 4;	// MSB first, LSB second
 			m_command = 0;
 			m_busy	  = true;
 			vox_decoder_t::reset();
 		}
+		else
+		{
+			m_host.m_stats.voice[voice].idle.inc();
+		}
 		m_out = 0;
 	}
 	else
@@ -170,7 +322,7 @@ void msm6295_core::voice_t::tick()
 		if ((++m_clock) >= 33)
 		{
 			bool is_end = (m_command != 0);	 // suspend
-			decode(bitfield(m_host.m_intf.read_byte(m_addr), m_nibble, 4));
+			decode(bitfield(m_host.read_byte(voice, m_addr), m_nibble, 4));
 			if (m_nibble <= 0)
 			{
 				m_nibble = 4;
@@ -185,6 +337,7 @@ void msm6295_core::voice_t::tick()
 			}
 			if (is_end)
 			{
+				m_host.m_stats.voice[voice].loop.inc();
 				m_command = 0;
 				m_busy	  = false;
 			}
@@ -208,15 +361,48 @@ void msm6295_core::voice_t::reset()
 	m_mute	  = false;
 }
 
+void msm6295_core::serialize(serializer_t &s)
+{
+	for (auto &elem : m_voice)
+	{
+		elem.serialize(s);
+	}
+
+	s.item(m_ss);
+	s.item(m_command);
+	s.item(m_next_command);
+	s.item(m_command_pending);
+	s.item(m_clock);
+	s.item(m_counter);
+	s.item(m_out);
+	s.item(m_out_temp);
+}
+
+// mute flag is preview setting, not saved
+void msm6295_core::voice_t::serialize(serializer_t &s)
+{
+	vox_decoder_t::serialize(s);
+	s.item(m_clock);
+	s.item(m_busy);
+	s.item(m_command);
+	s.item(m_addr);
+	s.item(m_nibble);
+	s.item(m_end);
+	s.item(m_volume);
+	s.item(m_out);
+}
+
 // accessors
 u8 msm6295_core::busy_r()
 {
+	m_stats.access.inc();
 	return (m_voice[0].busy() ? 0x01 : 0x00) | (m_voice[1].busy() ? 0x02 : 0x00) |
 		   (m_voice[2].busy() ? 0x04 : 0x00) | (m_voice[3].busy() ? 0x08 : 0x00);
 }
 
 void msm6295_core::command_w(u8 data)
 {
+	m_stats.access.inc();
 	if (!m_command_pending)
 	{
 		m_next_command	  = data;
@@ -54,7 +54,28 @@ class msm6295_core : public vox_core
 
 				// internal state
 				virtual void reset() override;
-				void tick();
+				void tick(u8 voice);
+				void serialize(serializer_t &s);
+
+				// event skipping, in rounds of voice ticks
+				// rounds until next event includes event itself, 0 if no event
+				inline u32 event_delay()
+				{
+					if (m_busy)
+					{
+						return 33 - m_clock;
+					}
+					return (bitfield(m_command, 7) || (m_out != 0)) ? 1 : 0;
+				}
+
+				// skip rounds without event, must be less than event_delay()
+				inline void skip(u32 rounds)
+				{
+					if (m_busy)
+					{
+						m_clock += rounds;
+					}
+				}
 
 				// Setters
 				inline void set_command(u8 command) { m_command = command; }
@@ -101,6 +122,10 @@ class msm6295_core : public vox_core
 			, m_counter(0)
 			, m_out(0)
 			, m_out_temp(0)
+			, m_bank{rom_span_t()}
+			, m_phrase_bank(rom_span_t())
+			, m_stats()
+			, m_scope()
 		{
 		}
 
@@ -110,10 +135,37 @@ class msm6295_core : public vox_core
 
 		inline void ss_w(bool ss) { m_ss = ss; }  // SS pin
 
+		// bank windows for direct ROM access, changing bank is only pointer swap
+		// 256 KB address space is divided into 16 pages of 16 KB,
+		// unmapped page is fetched through memory interface
+		inline void set_bank(u8 page, const u8 *data, u32 size = 0x4000)
+		{
+			m_bank[page & 0xf].set(data, size);
+		}
+
+		// phrase table (0x000-0x3ff) bank, separated from sample pages
+		inline void set_phrase_bank(const u8 *data, u32 size = 0x400)
+		{
+			m_phrase_bank.set(data, size);
+		}
+
 		// internal state
 		void reset();
 		void tick();
 
+		// silence detection for auto sleep, true if no voice and command is pending
+		bool idle();
+
+		// advance ticks in idle state, same as calling tick() for ticks times
+		void skip_idle(u64 ticks);
+
+		// save state, sample ROM and banks aren't included
+		void serialize(serializer_t &s);
+
+		// render output into buffer, each sample is output after 33 rounds of voice ticks
+		// (input clock / 33 / (SS ? 5 : 4))
+		void render(s32 *out, u32 samples);
+
 		inline s32 out() { return m_out; }	// built in 12 bit DAC
 
 		// for preview
@@ -127,7 +179,47 @@ class msm6295_core : public vox_core
 
 		inline s32 voice_out(u8 voice) { return (voice < 4) ? m_voice[voice].out() : 0; }
 
+		// instrumentation, counted only if VGSOUND_EMU_ENABLE_STATS is defined
+		typedef core_stats_t<4> stats_t;
+
+		inline const stats_t &stats() { return m_stats; }
+
+		inline void reset_stats() { m_stats.reset(); }
+
+		// per-voice output capture for scope views, disabled by default
+		// one sample per round, output sample is 33 rounds (decimation 33 for output rate)
+		typedef voice_scope_t<4> scope_t;
+
+		inline scope_t &scope() { return m_scope; }
+
 	private:
+		// memory accessors
+		inline u8 read_byte(u8 voice, u32 address)
+		{
+			const rom_span_t &bank = m_bank[bitfield(address, 14, 4)];
+			if (bank.valid())
+			{
+				m_stats.voice[voice].direct.inc();
+				return bank.read_byte(bitfield(address, 0, 14));
+			}
+			m_stats.voice[voice].read.inc();
+			return m_intf.read_byte(address);
+		}
+
+		// event skipping
+		u32 command_delay();
+		void run(u32 rounds);
+
+		inline u8 read_phrase(u8 voice, u32 address)
+		{
+			if (m_phrase_bank.valid())
+			{
+				m_stats.voice[voice].direct.inc();
+				return m_phrase_bank.read_byte(address);
+			}
+			return read_byte(voice, address);
+		}
+
 		std::array<voice_t, 4> m_voice;
 		vgsound_emu_mem_intf &m_intf;  // common memory interface
 
@@ -139,6 +231,12 @@ class msm6295_core : public vox_core
 		u16 m_counter		   = 0;		 // another clock counter
 		s32 m_out			   = 0;		 // 12 bit output
 		s32 m_out_temp		   = 0;		 // temporary buffer of above
+
+		std::array<rom_span_t, 16> m_bank;	// Sample ROM pages
+		rom_span_t m_phrase_bank;			// Phrase table bank
+
+		stats_t m_stats;  // instrumentation counters
+		scope_t m_scope;  // per-voice output capture
 };
 
 #endif
@@ -78,6 +78,7 @@
 
 void n163_core::tick()
 {
+	m_stats.tick.inc();
 	if (m_multiplex)
 	{
 		m_out = 0;
@@ -94,51 +95,182 @@ void n163_core::tick()
 	}
 
 	// tick per each clock
-	const u32 freq = m_ram[m_voice_cycle + 0] | (u32(m_ram[m_voice_cycle + 2]) << 8) |
-					 (bitfield<u32>(m_ram[m_voice_cycle + 4], 0, 2) << 16);	 // 18 bit frequency
+	const s16 voice_out = voice_exec();
 
-	u32 accum = m_ram[m_voice_cycle + 1] | (u32(m_ram[m_voice_cycle + 3]) << 8) |
-				(u32(m_ram[m_voice_cycle + 5]) << 16);	// 24 bit accumulator
+	// update voice cycle
+	bool flush = m_multiplex ? true : false;
+	if (cycle_exec())
+	{
+		if (!m_multiplex)
+		{
+			flush = true;
+		}
+		scope_exec();
+	}
+
+	// output 4 bit waveform and volume, multiplexed
+	m_acc += voice_out;
+	if (flush)
+	{
+		m_out = m_acc / (m_multiplex ? 1 : (bitfield(m_ram[0x7f], 4, 3) + 1));
+		m_acc = 0;
+	}
+}
+
+// render output, each sample is single output update of tick
+// multiplexed: single voice slot (15 CPU clocks)
+// demultiplexed: all active voices, averaged (15 * active voices CPU clocks)
+void n163_core::render(s16 *out, u32 samples)
+{
+	if (m_disable)
+	{
+		m_stats.tick.inc(samples);
+		m_out = 0;
+		std::fill(out, out + samples, 0);
+		return;
+	}
+
+	if (m_multiplex)
+	{
+		m_stats.tick.inc(samples);
+		for (u32 s = 0; s < samples; s++)
+		{
+			m_out = m_acc + voice_exec();
+			m_acc = 0;
+			if (cycle_exec())
+			{
+				scope_exec();
+			}
+			out[s] = m_out;
+		}
+	}
+	else
+	{
+		for (u32 s = 0; s < samples; s++)
+		{
+			// advance all active voices in single pass
+			do
+			{
+				m_stats.tick.inc();
+				m_acc += voice_exec();
+			} while (!cycle_exec());
+			scope_exec();
+
+			m_out  = m_acc / (bitfield(m_ram[0x7f], 4, 3) + 1);
+			m_acc  = 0;
+			out[s] = m_out;
+		}
+	}
+}
+
+// render output at host rate, each voice slot is 15 CPU clocks
+void n163_core::render(s32 *out, u32 samples, u32 clock, u32 rate)
+{
+	const u32 slot = rate * 15;
+	for (u32 s = 0; s < samples; s++)
+	{
+		m_render_frac	+= clock;
+		const u32 slots = m_render_frac / slot;
+		m_render_frac	%= slot;
+		out[s] = slots ? ((run(slots) * 256) / s32(slots)) : (s32(m_out) * 256);
+	}
+}
+
+// run voice slots as same as tick, returns sum of outputs
+s32 n163_core::run(u32 slots)
+{
+	m_stats.tick.inc(slots);
+	if (m_disable)
+	{
+		m_out = 0;
+		return 0;
+	}
+
+	s32 sum = 0;
+	if (m_multiplex)
+	{
+		for (u32 i = 0; i < slots; i++)
+		{
+			m_out = m_acc + voice_exec();
+			m_acc = 0;
+			if (cycle_exec())
+			{
+				scope_exec();
+			}
+			sum += m_out;
+		}
+	}
+	else
+	{
+		for (u32 i = 0; i < slots; i++)
+		{
+			m_acc += voice_exec();
+			if (cycle_exec())
+			{
+				scope_exec();
+				m_out = m_acc / (bitfield(m_ram[0x7f], 4, 3) + 1);
+				m_acc = 0;
+			}
+			sum += m_out;
+		}
+	}
+	return sum;
+}
+
+// process current voice slot, returns voice output
+s16 n163_core::voice_exec()
+{
+	voice_t &voice = m_voice[bitfield(m_voice_cycle, 3, 3)];
 
-	const u16 length = 256 - (m_ram[m_voice_cycle + 4] & 0xfc);
-	const u8 addr	 = m_ram[m_voice_cycle + 6] + bitfield(accum, 16, 8);
-	const s16 wave	 = (bitfield(m_ram[bitfield(addr, 1, 7)], bitfield(addr, 0) << 2, 4) - 8);
-	const s16 volume = bitfield(m_ram[m_voice_cycle + 7], 0, 4);
+	// waveform at voice register area is read from RAM, accumulator may be changed
+	const u8 addr  = voice.offset() + bitfield(voice.accum(), 16, 8);
+	const s16 wave = (addr < 0x80)
+					 ? m_wave[addr]
+					 : (bitfield(ram_r(bitfield(addr, 1, 7)), bitfield(addr, 0) << 2, 4) - 8);
 
 	// get per-voice output
-	const s16 voice_out				= (wave * volume);
+	const s16 voice_out					  = (wave * voice.volume());
 	m_voice_out[(m_voice_cycle >> 3) & 7] = voice_out;
 
 	// accumulate address
-	accum = bitfield(accum + freq, 0, 24);
-	if (bitfield(accum, 16, 8) >= length)
-	{
-		accum = bitfield(accum, 0, 18);
+	const u32 prev = voice.accum();
+	voice.accumulate();
+
+	voice_stats_t &stats = m_stats.voice[7 - bitfield(m_voice_cycle, 3, 3)];
+	stats.tick.inc();
+	if (voice.volume() == 0)
+	{  // silent voice
+		stats.idle.inc();
 	}
+	if (voice.accum() < prev)
+	{  // waveform loop
+		stats.loop.inc();
+	}
+	return voice_out;
+}
 
-	// writeback to register
-	m_ram[m_voice_cycle + 1] = bitfield(accum, 0, 8);
-	m_ram[m_voice_cycle + 3] = bitfield(accum, 8, 8);
-	m_ram[m_voice_cycle + 5] = bitfield(accum, 16, 8);
-
-	// update voice cycle
-	bool flush	  = m_multiplex ? true : false;
+// update voice cycle, returns true when all active voices are processed
+bool n163_core::cycle_exec()
+{
 	m_voice_cycle -= 0x8;
 	if (m_voice_cycle < (0x78 - (bitfield(m_ram[0x7f], 4, 3) << 3)))
 	{
-		if (!m_multiplex)
-		{
-			flush = true;
-		}
 		m_voice_cycle = 0x78;
+		return true;
 	}
+	return false;
+}
 
-	// output 4 bit waveform and volume, multiplexed
-	m_acc += voice_out;
-	if (flush)
+// capture per-voice outputs after all active voices are processed
+void n163_core::scope_exec()
+{
+	if (m_scope.enabled() && m_scope.capture())
 	{
-		m_out = m_acc / (m_multiplex ? 1 : (bitfield(m_ram[0x7f], 4, 3) + 1));
-		m_acc = 0;
+		for (u8 v = 0; v < 8; v++)
+		{
+			m_scope.set(v, voice_out(v));
+		}
+		m_scope.next();
 	}
 }
 
@@ -148,23 +280,53 @@ void n163_core::reset()
 	m_disable	= false;
 	m_multiplex = true;
 	std::fill(m_ram.begin(), m_ram.end(), 0);
+	m_wave.fill(-8);
+	for (voice_t &elem : m_voice)
+	{
+		elem.reset();
+	}
 	m_voice_cycle = 0x78;
 	m_addr_latch.reset();
-	m_out = 0;
-	m_acc = 0;
+	m_out		  = 0;
+	m_acc		  = 0;
+	m_render_frac = 0;
+	m_scope.reset();
+}
+
+void n163_core::serialize(serializer_t &s)
+{
+	s.item(m_disable);
+	s.item(m_ram);
+	s.item(m_voice_cycle);
+	m_addr_latch.serialize(s);
+	s.item(m_out);
+	s.item(m_voice_out);
+	s.item(m_multiplex);
+	s.item(m_acc);
+	s.item(m_render_frac);
+	s.item(m_wave);
+	for (voice_t &elem : m_voice)
+	{
+		elem.serialize(s);
+	}
 }
 
 // accessor
 void n163_core::addr_w(u8 data)
 {
+	m_stats.access.inc();
 	// 0xf800-0xffff Sound address, increment
 	m_addr_latch.write(data);
 }
 
 void n163_core::data_w(u8 data, bool cpu_access)
 {
+	m_stats.access.inc();
 	// 0x4800-0x4fff Sound data write
-	m_ram[m_addr_latch.addr()] = data;
+	if (ram_r(m_addr_latch.addr()) != data)
+	{
+		ram_w(m_addr_latch.addr(), data);
+	}
 
 	// address latch increment
 	if (cpu_access && m_addr_latch.incr())
@@ -175,8 +337,9 @@ void n163_core::data_w(u8 data, bool cpu_access)
 
 u8 n163_core::data_r(bool cpu_access)
 {
+	m_stats.access.inc();
 	// 0x4800-0x4fff Sound data read
-	const u8 ret = m_ram[m_addr_latch.addr()];
+	const u8 ret = ram_r(m_addr_latch.addr());
 
 	// address latch increment
 	if (cpu_access && m_addr_latch.incr())
@@ -186,3 +349,26 @@ u8 n163_core::data_r(bool cpu_access)
 
 	return ret;
 }
+
+// RAM accessors
+u8 n163_core::ram_r(u8 addr)
+{
+	// accumulators are stored in decoded voice registers only
+	const u8 reg = bitfield(addr, 0, 3);
+	if ((addr >= 0x40) && ((reg == 1) || (reg == 3) || (reg == 5)))
+	{
+		return m_voice[bitfield(addr, 3, 3)].accum_r(reg);
+	}
+	return m_ram[addr];
+}
+
+void n163_core::ram_w(u8 addr, u8 data)
+{
+	m_ram[addr]				= data;
+	m_wave[addr << 1]		= bitfield(data, 0, 4) - 8;
+	m_wave[(addr << 1) | 1] = bitfield(data, 4, 4) - 8;
+	if (addr >= 0x40)  // voice registers
+	{
+		m_voice[bitfield(addr, 3, 3)].write(addr, data);
+	}
+}
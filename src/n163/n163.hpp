@@ -33,6 +33,12 @@ class n163_core : public vgsound_emu_core
 					m_incr = 0;
 				}
 
+				void serialize(serializer_t &s)
+				{
+					m_addr = s.value<u8>(m_addr);
+					m_incr = s.value<u8>(m_incr);
+				}
+
 				// accessors
 				inline void write(u8 data)
 				{
@@ -52,6 +58,84 @@ class n163_core : public vgsound_emu_core
 				u8 m_incr : 1;
 		};
 
+		// Decoded voice registers, shadow of voice register area in RAM
+		class voice_t
+		{
+			public:
+				voice_t()
+					: m_freq(0)
+					, m_accum(0)
+					, m_length(256)
+					, m_offset(0)
+					, m_volume(0)
+				{
+				}
+
+				void reset()
+				{
+					m_freq	 = 0;
+					m_accum	 = 0;
+					m_length = 256;
+					m_offset = 0;
+					m_volume = 0;
+				}
+
+				void serialize(serializer_t &s)
+				{
+					s.item(m_freq);
+					s.item(m_accum);
+					s.item(m_length);
+					s.item(m_offset);
+					s.item(m_volume);
+				}
+
+				// register accessors
+				inline void write(u8 reg, u8 data)
+				{
+					switch (reg & 7)
+					{
+						case 0: m_freq = (m_freq & ~0x0000ff) | data; break;
+						case 1: m_accum = (m_accum & ~0x0000ff) | data; break;
+						case 2: m_freq = (m_freq & ~0x00ff00) | (u32(data) << 8); break;
+						case 3: m_accum = (m_accum & ~0x00ff00) | (u32(data) << 8); break;
+						case 4:
+							m_freq	 = (m_freq & ~0x030000) | (u32(data & 3) << 16);
+							m_length = 256 - (data & 0xfc);
+							break;
+						case 5: m_accum = (m_accum & ~0xff0000) | (u32(data) << 16); break;
+						case 6: m_offset = data; break;
+						case 7: m_volume = data & 0xf; break;
+					}
+				}
+
+				// accumulator byte, reg must be 1, 3 or 5
+				inline u8 accum_r(u8 reg) { return (m_accum >> ((reg >> 1) << 3)) & 0xff; }
+
+				// accumulate address
+				inline void accumulate()
+				{
+					m_accum = (m_accum + m_freq) & 0xffffff;
+					if ((m_accum >> 16) >= m_length)
+					{
+						m_accum &= 0x3ffff;
+					}
+				}
+
+				// getters
+				inline u32 accum() { return m_accum; }
+
+				inline u8 offset() { return m_offset; }
+
+				inline s16 volume() { return m_volume; }
+
+			private:
+				u32 m_freq	 = 0;	 // 18 bit frequency
+				u32 m_accum	 = 0;	 // 24 bit accumulator
+				u16 m_length = 256;	 // waveform length
+				u8 m_offset	 = 0;	 // waveform address
+				s16 m_volume = 0;	 // 4 bit volume
+		};
+
 	public:
 		n163_core()
 			: vgsound_emu_core("namco_163")
@@ -63,7 +147,13 @@ class n163_core : public vgsound_emu_core
 			, m_voice_out{0}
 			, m_multiplex(true)
 			, m_acc(0)
+			, m_render_frac(0)
+			, m_wave{0}
+			, m_voice{voice_t()}
+			, m_stats()
+			, m_scope()
 		{
+			m_wave.fill(-8);
 		}
 
 		// accessors, getters, setters
@@ -77,11 +167,24 @@ class n163_core : public vgsound_emu_core
 		void reset();
 		void tick();
 
-		// sound output pin
+		// save state, including shadow states of RAM
+		void serialize(serializer_t &s);
+
+		// render output into buffer, each sample is single output update of tick
+		// (single voice slot for multiplexed, all active voices for demultiplexed)
+		// output is same as out(), OUTPUT_BITS_N163
+		void render(s16 *out, u32 samples);
+
+		// render output into buffer at host rate, each sample is averaged output of clock / rate
+		// CPU clocks (15 clocks for each voice slot) in 8 bit fraction, OUTPUT_BITS_N163_HOST
+		// multiplexed: voice slots are averaged, demultiplexed: averaged rounds are averaged
+		void render(s32 *out, u32 samples, u32 clock, u32 rate);
+
+		// sound output pin, OUTPUT_BITS_N163
 		inline s16 out() { return m_out; }
 
 		// register pool
-		inline u8 reg(u8 addr) { return m_ram[addr & 0x7f]; }
+		inline u8 reg(u8 addr) { return ram_r(addr & 0x7f); }
 
 		inline void set_multiplex(bool multiplex = true) { m_multiplex = multiplex; }
 
@@ -93,7 +196,30 @@ class n163_core : public vgsound_emu_core
 			return (voice <= ((m_ram[0x7f] >> 4) & 7)) ? m_voice_out[7 - voice] : 0;
 		}
 
+		// instrumentation, counted only if VGSOUND_EMU_ENABLE_STATS is defined
+		// voice index is same as voice_out
+		typedef core_stats_t<8> stats_t;
+
+		inline const stats_t &stats() { return m_stats; }
+
+		inline void reset_stats() { m_stats.reset(); }
+
+		// per-voice output capture for scope views, disabled by default
+		// one sample per full voice cycle, voice index is same as voice_out
+		typedef voice_scope_t<8> scope_t;
+
+		inline scope_t &scope() { return m_scope; }
+
 	private:
+		s32 run(u32 slots);
+		s16 voice_exec();
+		bool cycle_exec();
+		void scope_exec();
+
+		// RAM accessors, with shadow states
+		u8 ram_r(u8 addr);
+		void ram_w(u8 addr, u8 data);
+
 		bool m_disable			   = false;
 		std::array<u8, 0x80> m_ram = {0};	 // internal 128 byte RAM
 		u8 m_voice_cycle		   = 0x78;	 // Voice cycle for processing
@@ -104,6 +230,15 @@ class n163_core : public vgsound_emu_core
 		// demultiplex related
 		bool m_multiplex = true;  // multiplex flag, but less noisy = inaccurate!
 		s16 m_acc		 = 0;	  // accumulated output
+
+		u32 m_render_frac = 0;	// fraction of clock / rate for render
+
+		// shadow states, updated at RAM writes
+		std::array<s8, 0x100> m_wave = {0};	 // unpacked 4 bit waveform, signed
+		std::array<voice_t, 8> m_voice;		 // decoded voice registers
+
+		stats_t m_stats;  // instrumentation counters
+		scope_t m_scope;  // per-voice output capture
 };
 
 #endif
@@ -333,16 +333,32 @@
 // shared SCC features
 void scc_core::tick()
 {
+	m_stats.tick.inc();
 	m_out = 0;
-	for (auto &elem : m_voice)
+	for (u8 v = 0; v < 5; v++)
 	{
-		elem.tick();
-		m_out += elem.out();
+		m_voice[v].tick(v);
+		m_out += m_voice[v].out();
+	}
+
+	if (m_scope.enabled() && m_scope.capture())
+	{
+		for (u8 v = 0; v < 5; v++)
+		{
+			m_scope.set(v, m_voice[v].out());
+		}
+		m_scope.next();
 	}
 }
 
-void scc_core::voice_t::tick()
+void scc_core::voice_t::tick(u8 voice)
 {
+	m_host.m_stats.voice[voice].tick.inc();
+	if ((m_pitch < 9) || (!m_enable))
+	{  // halted or muted
+		m_host.m_stats.voice[voice].idle.inc();
+	}
+
 	if (m_pitch >= 9)  // or voice is halted
 	{
 		// update counter - Post decrement
@@ -366,6 +382,10 @@ void scc_core::voice_t::tick()
 		{
 			m_addr	  = bitfield(m_addr + 1, 0, 5);
 			m_counter = m_pitch;
+			if (m_addr == 0)
+			{  // waveform loop
+				m_host.m_stats.voice[voice].loop.inc();
+			}
 		}
 	}
 	// get output
@@ -379,6 +399,62 @@ void scc_core::voice_t::tick()
 	}
 }
 
+// every voice is halted, disabled or muted
+// test register changes counter behavior of running voices, so only halted voices are allowed
+bool scc_core::idle()
+{
+	if (m_scope.enabled())
+	{
+		return false;
+	}
+
+	const bool test = m_test.freq_4bit() || m_test.freq_8bit();
+	for (voice_t &elem : m_voice)
+	{
+		if (!elem.idle() || (test && (elem.pitch() >= 9)))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+void scc_core::skip_idle(u64 ticks)
+{
+	if (ticks == 0)
+	{
+		return;
+	}
+
+	m_stats.tick.inc(ticks);
+	m_out = 0;
+	for (voice_t &elem : m_voice)
+	{
+		elem.skip_idle(ticks);
+		m_out += elem.out();
+	}
+}
+
+// waveform pointer of disabled or muted voice is still running, counter period is pitch + 1
+void scc_core::voice_t::skip_idle(u64 ticks)
+{
+	if (m_pitch >= 9)
+	{
+		if (ticks <= m_counter)
+		{
+			m_counter -= u16(ticks);
+		}
+		else
+		{
+			const u64 rest	 = ticks - m_counter - 1;
+			const u64 period = u64(m_pitch) + 1;
+			m_addr			 = u8(bitfield<u64>(m_addr + 1 + (rest / period), 0, 5));
+			m_counter		 = m_pitch - u16(rest % period);
+		}
+	}
+	m_out = m_enable ? ((m_wave[m_addr] * m_volume) >> 4) : 0;
+}
+
 void scc_core::reset()
 {
 	for (auto &elem : m_voice)
@@ -389,6 +465,7 @@ void scc_core::reset()
 	m_test.reset();
 	m_out = 0;
 	std::fill(m_reg.begin(), m_reg.end(), 0);
+	m_scope.reset();
 }
 
 void scc_core::voice_t::reset()
@@ -402,6 +479,29 @@ void scc_core::voice_t::reset()
 	m_out	  = 0;
 }
 
+void scc_core::serialize(serializer_t &s)
+{
+	for (auto &elem : m_voice)
+	{
+		elem.serialize(s);
+	}
+
+	m_test.serialize(s);
+	s.item(m_out);
+	s.item(m_reg);
+}
+
+void scc_core::voice_t::serialize(serializer_t &s)
+{
+	s.item(m_wave);
+	s.item(m_enable);
+	m_pitch	 = s.value<u16>(m_pitch);
+	m_volume = s.value<u16>(m_volume);
+	s.item(m_addr);
+	s.item(m_counter);
+	s.item(m_out);
+}
+
 // SCC accessors
 u8 scc_core::wave_r(bool is_sccplus, u8 address)
 {
@@ -520,6 +620,7 @@ void scc_core::freq_vol_enable_w(u8 address, u8 data)
 
 void k051649_scc_core::scc_w(bool is_sccplus, u8 address, u8 data)
 {
+	m_stats.access.inc();
 	const u8 voice = bitfield(address, 5, 3);
 	switch (voice)
 	{
@@ -545,6 +646,7 @@ void k051649_scc_core::scc_w(bool is_sccplus, u8 address, u8 data)
 
 void k052539_scc_core::scc_w(bool is_sccplus, u8 address, u8 data)
 {
+	m_stats.access.inc();
 	const u8 voice = bitfield(address, 5, 3);
 	if (is_sccplus)
 	{
@@ -596,6 +698,7 @@ void k052539_scc_core::scc_w(bool is_sccplus, u8 address, u8 data)
 
 u8 k051649_scc_core::scc_r(bool is_sccplus, u8 address)
 {
+	m_stats.access.inc();
 	const u8 voice = bitfield(address, 5, 3);
 	const u8 wave  = bitfield(address, 0, 5);
 	u8 ret		   = 0xff;
@@ -614,6 +717,7 @@ u8 k051649_scc_core::scc_r(bool is_sccplus, u8 address)
 
 u8 k052539_scc_core::scc_r(bool is_sccplus, u8 address)
 {
+	m_stats.access.inc();
 	const u8 voice = bitfield(address, 5, 3);
 	const u8 wave  = bitfield(address, 0, 5);
 	u8 ret		   = 0xff;
@@ -679,6 +783,35 @@ void k052539_core::k052539_mapper_t::reset()
 	std::fill(m_ram_enable.begin(), m_ram_enable.end(), false);
 }
 
+void k051649_core::serialize(serializer_t &s)
+{
+	k051649_scc_core::serialize(s);
+	m_mapper.serialize(s);
+	s.item(m_scc_enable);
+}
+
+void k052539_core::serialize(serializer_t &s)
+{
+	k052539_scc_core::serialize(s);
+	m_mapper.serialize(s);
+	s.item(m_scc_enable);
+	s.item(m_is_sccplus);
+}
+
+void k051649_core::k051649_mapper_t::serialize(serializer_t &s)
+{
+	for (u8 &elem : m_bank)
+	{
+		s.item(elem);
+	}
+}
+
+void k052539_core::k052539_mapper_t::serialize(serializer_t &s)
+{
+	s.item(m_bank);
+	s.item(m_ram_enable);
+}
+
 // Mapper accessors
 u8 k051649_core::read(u16 address)
 {
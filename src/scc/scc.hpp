@@ -41,7 +41,14 @@ class scc_core : public vgsound_emu_core
 
 				// internal state
 				void reset();
-				void tick();
+				void tick(u8 voice);
+				void serialize(serializer_t &s);
+
+				// silence detection, output is unchanged if halted, disabled or muted
+				inline bool idle() { return (m_pitch < 9) || (!m_enable) || (m_volume == 0); }
+
+				// advance ticks in idle state, normal frequency mode only
+				void skip_idle(u64 ticks);
 
 				// accessors
 				inline void reset_addr() { m_addr = 0; }
@@ -62,6 +69,8 @@ class scc_core : public vgsound_emu_core
 				// getters
 				inline s8 wave(u8 addr) { return m_wave[addr & 0x1f]; }
 
+				inline u16 pitch() { return m_pitch; }
+
 				inline u8 addr() { return m_addr; }
 
 				inline s32 out() { return m_out; }
@@ -101,6 +110,15 @@ class scc_core : public vgsound_emu_core
 					m_rotate4	= 0;
 				}
 
+				void serialize(serializer_t &s)
+				{
+					m_freq_4bit = s.value<u8>(m_freq_4bit);
+					m_freq_8bit = s.value<u8>(m_freq_8bit);
+					m_resetpos	= s.value<u8>(m_resetpos);
+					m_rotate	= s.value<u8>(m_rotate);
+					m_rotate4	= s.value<u8>(m_rotate4);
+				}
+
 				// setters
 				inline void set_freq_4bit(bool freq_4bit) { m_freq_4bit = freq_4bit; }
 
@@ -139,6 +157,8 @@ class scc_core : public vgsound_emu_core
 			, m_test(test_t())
 			, m_out(0)
 			, m_reg{0}
+			, m_stats()
+			, m_scope()
 		{
 		}
 
@@ -153,6 +173,15 @@ class scc_core : public vgsound_emu_core
 		virtual void reset();
 		void tick();
 
+		// silence detection for auto sleep, true if output is unchanged in following ticks
+		bool idle();
+
+		// advance ticks in idle state, same as calling tick() for ticks times
+		void skip_idle(u64 ticks);
+
+		// save state, sound and mapper registers
+		virtual void serialize(serializer_t &s);
+
 		// getters
 		inline s32 out() { return m_out; }	// output to DA0...DA10 pin
 
@@ -161,6 +190,18 @@ class scc_core : public vgsound_emu_core
 		// for preview
 		inline s32 voice_out(u8 voice) { return (voice < 5) ? m_voice[voice].out() : 0; }
 
+		// instrumentation, counted only if VGSOUND_EMU_ENABLE_STATS is defined
+		typedef core_stats_t<5> stats_t;
+
+		inline const stats_t &stats() { return m_stats; }
+
+		inline void reset_stats() { m_stats.reset(); }
+
+		// per-voice output capture for scope views, disabled by default
+		typedef voice_scope_t<5> scope_t;
+
+		inline scope_t &scope() { return m_scope; }
+
 	protected:
 		// accessor
 		u8 wave_r(bool is_sccplus, u8 address);
@@ -174,6 +215,9 @@ class scc_core : public vgsound_emu_core
 		s32 m_out				  = 0;	// output to DA0...10
 
 		std::array<u8, 256> m_reg = {0};  // register pool
+
+		stats_t m_stats;  // instrumentation counters
+		scope_t m_scope;  // per-voice output capture
 };
 
 // SCC core
@@ -223,6 +267,7 @@ class k051649_core : public k051649_scc_core
 
 				// internal state
 				void reset();
+				void serialize(serializer_t &s);
 
 				// setters
 				inline void set_bank(u8 slot, u8 bank) { m_bank[slot & 3] = bank; }
@@ -250,6 +295,7 @@ class k051649_core : public k051649_scc_core
 		void write(u16 address, u8 data);
 
 		virtual void reset() override;
+		virtual void serialize(serializer_t &s) override;
 
 	private:
 		vgsound_emu_mem_intf m_intf;
@@ -276,6 +322,7 @@ class k052539_core : public k052539_scc_core
 
 				// internal state
 				void reset();
+				void serialize(serializer_t &s);
 
 				// setters
 				inline void set_bank(u8 slot, u8 bank) { m_bank[slot & 3] = bank; }
@@ -312,6 +359,7 @@ class k052539_core : public k052539_scc_core
 		void write(u16 address, u8 data);
 
 		virtual void reset() override;
+		virtual void serialize(serializer_t &s) override;
 
 	private:
 		vgsound_emu_mem_intf m_intf;
@@ -0,0 +1,361 @@
+/*
+	License: Zlib
+	see https://gitlab.com/cam900/vgsound_emu/-/blob/main/LICENSE for more details
+
+	Copyright holder(s): cam900
+	Headless batch renderer for VGM logs
+
+	Renders VGM logs into 16 bit stereo WAV or raw PCM files, input files are
+   distributed into worker threads (all CPU cores by default), and each
+   worker renders single file at once.
+
+	Output is written in large blocks with large stdio buffer, so output I/O
+   is sequential.
+
+	Real-time factor of each files is reported, it's rendered audio length
+   divided by wall clock time for rendering (higher is faster). Ratio of
+   rendered audio with every chips sleeping is also reported; auto sleep
+   doesn't change output.
+
+	Usage:
+	batch_render [options] input.vgm ...
+
+	Options:
+	-o dir   Output directory (default: same as input)
+	-f fmt   Output format, wav or raw (default: wav)
+	-r rate  Output sample rate (default: 44100)
+	-j jobs  Worker threads (default: CPU cores)
+	-l loops Loop count (default: 0)
+	-t secs  Maximum length in seconds (default: 600), WAV is limited to 4 GB
+	-s sleep Auto sleep of idle chips, 0 or 1 (default: 1)
+
+	Build (from repository root):
+	cmake -S . -B build && cmake --build build --target batch_render
+*/
+
+#include "../core/convert.hpp"
+#include "../vgm/vgm.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <thread>
+
+namespace
+{
+	struct options_t
+	{
+			std::string outdir = "";	 // output directory
+			bool raw		   = false;	 // raw PCM output
+			u32 rate		   = 44100;	 // output sample rate
+			u32 jobs		   = 0;		 // worker threads
+			u32 loops		   = 0;		 // loop count
+			u32 max_seconds	   = 600;	 // maximum length
+			bool sleep		   = true;	 // auto sleep of idle chips
+	};
+
+	// 16 bit stereo output file
+	class pcm_writer_t
+	{
+		public:
+			pcm_writer_t()
+				: m_file(nullptr)
+				, m_raw(false)
+				, m_rate(0)
+				, m_bytes(0)
+				, m_pcm()
+				, m_buf()
+			{
+			}
+
+			~pcm_writer_t() { close(); }
+
+			bool open(const std::string &path, bool raw, u32 rate)
+			{
+				close();
+				m_file = std::fopen(path.c_str(), "wb");
+				if (m_file == nullptr)
+				{
+					return false;
+				}
+				std::setvbuf(m_file, nullptr, _IOFBF, 0x100000);
+				m_raw	= raw;
+				m_rate	= rate;
+				m_bytes = 0;
+				if (!m_raw)
+				{
+					return write_header();	// placeholder, updated at close
+				}
+				return true;
+			}
+
+			// maximum samples of output, WAV sizes are 32 bit
+			u64 max_samples() const
+			{
+				return m_raw ? ~u64(0) : (u64(0xffffffff - 36) >> 2);
+			}
+
+			// returns false if not every samples are written
+			bool write(const s32 *in, u32 samples)
+			{
+				m_pcm.resize(samples << 1);
+				convert_s16(in, m_pcm.data(), samples << 1, OUTPUT_BITS_BOARD);
+				m_buf.resize(samples << 2);
+				u8 *out = m_buf.data();
+				for (u32 i = 0; i < (samples << 1); i++)
+				{
+					out[(i << 1) + 0] = u8(m_pcm[i] & 0xff);
+					out[(i << 1) + 1] = u8((m_pcm[i] >> 8) & 0xff);
+				}
+				const size_t written = std::fwrite(out, 1, m_buf.size(), m_file);
+				m_bytes += written;
+				return written == m_buf.size();
+			}
+
+			// returns false if header update, buffered output or closing is failed
+			bool close()
+			{
+				if (m_file == nullptr)
+				{
+					return true;
+				}
+
+				bool ok = true;
+				if (!m_raw)
+				{
+					ok = (std::fseek(m_file, 0, SEEK_SET) == 0) && write_header();
+				}
+				ok = (std::ferror(m_file) == 0) && ok;
+				ok = (std::fclose(m_file) == 0) && ok;
+				m_file = nullptr;
+				return ok;
+			}
+
+		private:
+			bool write_header()
+			{
+				u8 header[44];
+				auto le = [&header](u32 offset, u32 data, u8 bytes)
+				{
+					for (u8 b = 0; b < bytes; b++)
+					{
+						header[offset + b] = u8((data >> (b << 3)) & 0xff);
+					}
+				};
+				std::memcpy(header + 0, "RIFF", 4);
+				le(4, u32(36 + m_bytes), 4);
+				std::memcpy(header + 8, "WAVEfmt ", 8);
+				le(16, 16, 4);			 // fmt chunk size
+				le(20, 1, 2);			 // PCM
+				le(22, 2, 2);			 // stereo
+				le(24, m_rate, 4);		 // sample rate
+				le(28, m_rate << 2, 4);	 // byte rate
+				le(32, 4, 2);			 // block align
+				le(34, 16, 2);			 // bits per sample
+				std::memcpy(header + 36, "data", 4);
+				le(40, u32(m_bytes), 4);
+				return std::fwrite(header, 1, 44, m_file) == 44;
+			}
+
+			std::FILE *m_file = nullptr;  // output file
+			bool m_raw		  = false;	  // raw PCM output
+			u32 m_rate		  = 0;		  // sample rate
+			u64 m_bytes		  = 0;		  // written PCM bytes
+			std::vector<s16> m_pcm;		  // converted samples
+			std::vector<u8> m_buf;		  // little endian output
+	};
+
+	std::string output_path(const options_t &opt, const std::string &input)
+	{
+		std::string name = input;
+		std::string dir	 = "";
+		const size_t sep = input.find_last_of("/\\");
+		if (sep != std::string::npos)
+		{
+			dir	 = input.substr(0, sep + 1);
+			name = input.substr(sep + 1);
+		}
+
+		const size_t ext = name.find_last_of('.');
+		if (ext != std::string::npos)
+		{
+			name = name.substr(0, ext);
+		}
+
+		if (!opt.outdir.empty())
+		{
+			dir = opt.outdir;
+			if ((dir.back() != '/') && (dir.back() != '\\'))
+			{
+				dir += '/';
+			}
+		}
+		return dir + name + (opt.raw ? ".raw" : ".wav");
+	}
+
+	// render single file, returns false if failed
+	bool render_file(const options_t &opt, const std::string &input, std::string &report)
+	{
+		const auto begin = std::chrono::steady_clock::now();
+
+		vgm_file_reader reader;
+		if (!reader.open(input))
+		{
+			report = input + ": can't open";
+			return false;
+		}
+
+		vgm_player_core player(opt.rate);
+		if (!player.open(reader))
+		{
+			report = input + ": not a VGM file";
+			return false;
+		}
+		player.set_loops(opt.loops);
+		player.board().set_auto_sleep(opt.sleep);
+
+		const std::string output = output_path(opt, input);
+		pcm_writer_t writer;
+		if (!writer.open(output, opt.raw, opt.rate))
+		{
+			report = output + ": can't create";
+			return false;
+		}
+
+		// render in large blocks, WAV output is clamped into 32 bit size
+		const u32 block	  = 0x10000;
+		const u64 request = u64(opt.max_seconds) * opt.rate;
+		const u64 limit	  = std::min<u64>(request, writer.max_samples());
+		std::vector<s32> buf(block << 1);
+		u64 samples = 0;
+		while (samples < limit)
+		{
+			const u32 len	   = u32(std::min<u64>(block, limit - samples));
+			const u32 rendered = player.render(buf.data(), len);
+			if (!writer.write(buf.data(), rendered))
+			{
+				writer.close();
+				report = output + ": write failed";
+				return false;
+			}
+			samples += rendered;
+			if (rendered < len)
+			{
+				break;
+			}
+		}
+		if (!writer.close())
+		{
+			report = output + ": write failed";
+			return false;
+		}
+
+		const f64 wall =
+		  std::chrono::duration<f64>(std::chrono::steady_clock::now() - begin).count();
+		const f64 length = f64(samples) / f64(opt.rate);
+		char line[256];
+		std::snprintf(line,
+					  sizeof(line),
+					  ": %.2f s audio in %.3f s, RTF %.1fx, sleep %.1f%%",
+					  length,
+					  wall,
+					  (wall > 0.0) ? (length / wall) : 0.0,
+					  samples ? (f64(player.board().slept()) * 100.0 / f64(samples)) : 0.0);
+		report = input + line;
+		if ((limit < request) && (samples >= limit))
+		{
+			report += ", truncated at WAV size limit";
+		}
+		return true;
+	}
+
+	void usage()
+	{
+		std::fprintf(stderr,
+					 "usage: batch_render [-o dir] [-f wav|raw] [-r rate] [-j jobs] [-l loops] "
+					 "[-t secs] [-s 0|1] input.vgm ...\n");
+	}
+}  // namespace
+
+int main(int argc, char **argv)
+{
+	options_t opt;
+	std::vector<std::string> inputs;
+	for (int i = 1; i < argc; i++)
+	{
+		const std::string arg = argv[i];
+		if ((arg.size() == 2) && (arg[0] == '-') && ((i + 1) < argc))
+		{
+			const std::string value = argv[++i];
+			switch (arg[1])
+			{
+				case 'o': opt.outdir = value; break;
+				case 'f': opt.raw = (value == "raw"); break;
+				case 'r': opt.rate = u32(std::strtoul(value.c_str(), nullptr, 0)); break;
+				case 'j': opt.jobs = u32(std::strtoul(value.c_str(), nullptr, 0)); break;
+				case 'l': opt.loops = u32(std::strtoul(value.c_str(), nullptr, 0)); break;
+				case 't': opt.max_seconds = u32(std::strtoul(value.c_str(), nullptr, 0)); break;
+				case 's': opt.sleep = (value != "0"); break;
+				default: usage(); return 1;
+			}
+		}
+		else
+		{
+			inputs.push_back(arg);
+		}
+	}
+
+	if (inputs.empty() || (opt.rate == 0))
+	{
+		usage();
+		return 1;
+	}
+
+	if (opt.jobs == 0)
+	{
+		opt.jobs = std::max<u32>(1, std::thread::hardware_concurrency());
+	}
+	opt.jobs = std::min<u32>(opt.jobs, u32(inputs.size()));
+
+	// each worker takes next input file
+	std::atomic<u32> next(0);
+	std::atomic<u32> failed(0);
+	std::mutex report_mutex;
+	const auto begin = std::chrono::steady_clock::now();
+	auto worker		 = [&]()
+	{
+		u32 index;
+		while ((index = next++) < inputs.size())
+		{
+			std::string report;
+			if (!render_file(opt, inputs[index], report))
+			{
+				failed++;
+			}
+			std::lock_guard<std::mutex> lock(report_mutex);
+			std::printf("%s\n", report.c_str());
+			std::fflush(stdout);
+		}
+	};
+
+	std::vector<std::thread> threads;
+	for (u32 j = 0; j < opt.jobs; j++)
+	{
+		threads.emplace_back(worker);
+	}
+	for (std::thread &elem : threads)
+	{
+		elem.join();
+	}
+
+	const f64 wall = std::chrono::duration<f64>(std::chrono::steady_clock::now() - begin).count();
+	std::printf("%u files, %u failed, %u jobs, %.3f s\n",
+				u32(inputs.size()),
+				failed.load(),
+				opt.jobs,
+				wall);
+	return (failed.load() != 0) ? 1 : 0;
+}
@@ -0,0 +1,1507 @@
+/*
+	License: Zlib
+	see https://gitlab.com/cam900/vgsound_emu/-/blob/main/LICENSE for more details
+
+	Copyright holder(s): cam900
+	Differential test harness for reference and optimized update routines
+
+	Each test runs reference path and optimized path of same core side by side,
+   feeds same pseudo random register script into both, and compares them.
+   Script is deterministic for each seed, so divergence is reproducible.
+   First divergence of each compared state and summary is reported, and exit
+   status is non-zero if any divergence is found.
+
+	ES5504/ES5505/ES5506 (5504, 5505, 5506):
+	Compares cycle accurate tick() (reference) with tick_perf() (optimized).
+
+	Each step of script is optional single host access, then both cores are
+   advanced by single voice update; reference is ticked until voice update flag
+   is set, optimized is updated with single tick_perf call. Host access is
+   issued at E rising edge of reference, where it's applied immediately like
+   optimized path, and it's limited to one per step.
+
+	Compared states:
+	- Per-voice outputs, at each step
+	- Channel outputs (ES5504, ES5505), at each step
+	  (ES5506 output is serial output with latency, it's not compared)
+	- Host read results
+	- IRQB callbacks, recorded with step number
+	- Register readback of all pages via debug accessor, without side effects
+
+	Some writes are outside of what optimized path models, these are skipped
+   unless -a is set:
+	- Writes into voice of next update; optimized path applies it before both
+	  sample fetches of this voice, reference applies it between them
+	- ES5506 MODE register; optimized path runs in single OTTO master mode only,
+	  it's set before script
+
+	Block renderers:
+	Compares per-sample update (reference) with block renderer (optimized).
+
+	Each step of script is optional host access, then both cores render block
+   of random length; reference calls tick() (or tick_perf() for render_perf)
+   for each sample and reads outputs by getters, host rate renderers are
+   averaged with same fractional clock accumulator.
+
+	- 5504p:    es5504_core::render_perf, against tick_perf()
+	- x1_010:   x1_010_core::render
+	- n163:     n163_core::render, each sample is single output update
+	- n163h:    n163_core::render at host rate
+	- vrcvi:    vrcvi_core::render at host rate
+	- vrcvia:   vrcvi_core::advance
+	- k007232:  k007232_core::render, NE 0 from direct ROM, NE 1 from interface
+	- k007232s: k007232_core::render_stereo
+	- k005289:  k005289_bubble_core::render at host rate
+	- msm6295:  msm6295_core::render, even pages from direct ROM
+
+	Compared states:
+	- Rendered outputs, at each sample
+	- Per-voice outputs and internal counters visible via getters, at each step
+	- Interface callbacks, recorded with step number
+	- Register readback, without side effects
+
+	Usage:
+	core_diff [options]
+
+	Options:
+	-c chip  Test to run, one of above or all (default: all)
+	-s seed  Script seed (default: 1)
+	-n steps Script length in voice updates for ES550x (default: 100000)
+	-b steps Script length in blocks for block renderers (default: 5000)
+	-l len   Maximum block length in samples (default: 256)
+	-r steps Register readback interval (default: 256)
+	-a 0|1   Script unmodeled writes for ES550x (default: 0)
+
+	Build (from repository root):
+	cmake -S . -B build && cmake --build build --target core_diff
+*/
+
+#include "../es550x/es5504.hpp"
+#include "../es550x/es5505.hpp"
+#include "../es550x/es5506.hpp"
+#include "../k005289/k005289.hpp"
+#include "../k007232/k007232.hpp"
+#include "../msm6295/msm6295.hpp"
+#include "../n163/n163.hpp"
+#include "../vrcvi/vrcvi.hpp"
+#include "../x1_010/x1_010.hpp"
+
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace
+{
+	struct options_t
+	{
+			std::string chip = "all";	// chip to test
+			u32 seed		 = 1;		// script seed
+			u32 steps		 = 100000;	// script length
+			u32 blocks		 = 5000;	// script length for block renderers
+			u32 length		 = 256;		// maximum block length
+			u32 readback	 = 256;		// readback interval
+			bool all_writes	 = false;	// script unmodeled writes
+	};
+
+	// xorshift32, deterministic for each seed
+	class rng_t
+	{
+		public:
+			rng_t(u32 seed)
+				: m_state(seed ? seed : 0x12345678)
+			{
+			}
+
+			inline u32 next()
+			{
+				m_state ^= m_state << 13;
+				m_state ^= m_state >> 17;
+				m_state ^= m_state << 5;
+				return m_state;
+			}
+
+		private:
+			u32 m_state = 0x12345678;  // generator state
+	};
+
+	// sample memory and IRQB callback recorder
+	class harness_intf : public es550x_intf
+	{
+		public:
+			harness_intf()
+				: es550x_intf()
+				, m_step(0)
+				, m_irq()
+			{
+			}
+
+			virtual void irqb(bool state) override
+			{
+				m_irq.push_back((u64(m_step) << 1) | (state ? 1 : 0));
+			}
+
+			// hashed from address, each bank has different contents
+			virtual s16 read_sample(u8 voice, u8 bank, u32 address) override
+			{
+				u32 hash = (u32(bank) << 24) ^ address;
+				hash	 *= 0x9e3779b1;
+				hash	 ^= hash >> 15;
+				return s16(hash >> 16);
+			}
+
+			inline void set_step(u32 step) { m_step = step; }
+
+			inline const std::vector<u64> &irq() { return m_irq; }
+
+		private:
+			u32 m_step = 0;			 // current step
+			std::vector<u64> m_irq;	 // IRQB callbacks, step << 1 | state
+	};
+
+	// chip specific parts
+	struct es5504_traits
+	{
+			typedef es5504_core core_t;
+
+			static const char *name() { return "ES5504"; }
+
+			static void init(core_t &core) {}
+
+			static void write(core_t &core, u32 rnd) { core.host_w(rnd & 0xf, u16(rnd >> 16)); }
+
+			static u32 read(core_t &core, u32 rnd) { return core.host_r(rnd & 0xf); }
+
+			static u32 address(u32 rnd) { return rnd & 0xf; }
+
+			static bool global(u32 rnd) { return (rnd & 0xf) >= 12; }
+
+			static bool modeled(u32 rnd) { return true; }
+
+			static void outputs(core_t &core, std::vector<s32> &voice, std::vector<s32> &ch)
+			{
+				voice.clear();
+				ch.clear();
+				for (u8 v = 0; v < 25; v++)
+				{
+					voice.push_back(core.voice_out(v));
+				}
+				for (u8 c = 0; c < 16; c++)
+				{
+					ch.push_back(core.out(c));
+				}
+			}
+
+			static u32 readback(core_t &core, u8 page, u8 address)
+			{
+				return core.regs_r(page, address, false);
+			}
+	};
+
+	struct es5505_traits
+	{
+			typedef es5505_core core_t;
+
+			static const char *name() { return "ES5505"; }
+
+			static void init(core_t &core) {}
+
+			static void write(core_t &core, u32 rnd) { core.host_w(rnd & 0xf, u16(rnd >> 16)); }
+
+			static u32 read(core_t &core, u32 rnd) { return core.host_r(rnd & 0xf); }
+
+			static u32 address(u32 rnd) { return rnd & 0xf; }
+
+			static bool global(u32 rnd) { return (rnd & 0xf) >= 12; }
+
+			static bool modeled(u32 rnd) { return true; }
+
+			static void outputs(core_t &core, std::vector<s32> &voice, std::vector<s32> &ch)
+			{
+				voice.clear();
+				ch.clear();
+				for (u8 v = 0; v < 32; v++)
+				{
+					voice.push_back(core.voice_lout(v));
+					voice.push_back(core.voice_rout(v));
+				}
+				for (u8 c = 0; c < 4; c++)
+				{
+					ch.push_back(core.lout(c));
+					ch.push_back(core.rout(c));
+				}
+			}
+
+			static u32 readback(core_t &core, u8 page, u8 address)
+			{
+				return core.regs_r(page, address, false);
+			}
+	};
+
+	struct es5506_traits
+	{
+			typedef es5506_core core_t;
+
+			static const char *name() { return "ES5506"; }
+
+			// single OTTO master mode, optimized path fetches samples in this mode only
+			static void init(core_t &core)
+			{
+				core.host_w(0x30, 0x00);
+				core.host_w(0x31, 0x00);
+				core.host_w(0x32, 0x00);
+				core.host_w(0x33, 0x08);
+			}
+
+			static void write(core_t &core, u32 rnd) { core.host_w(rnd & 0x3f, u8(rnd >> 16)); }
+
+			static u32 read(core_t &core, u32 rnd) { return core.host_r(rnd & 0x3f); }
+
+			static u32 address(u32 rnd) { return rnd & 0x3f; }
+
+			static bool global(u32 rnd) { return ((rnd >> 2) & 0xf) >= 13; }
+
+			// MODE register
+			static bool modeled(u32 rnd) { return ((rnd >> 2) & 0xf) != 12; }
+
+			static void outputs(core_t &core, std::vector<s32> &voice, std::vector<s32> &ch)
+			{
+				voice.clear();
+				ch.clear();
+				for (u8 v = 0; v < 32; v++)
+				{
+					voice.push_back(core.voice_lout(v));
+					voice.push_back(core.voice_rout(v));
+				}
+			}
+
+			static u32 readback(core_t &core, u8 page, u8 address)
+			{
+				return core.regs_r(page, address, false);
+			}
+	};
+
+	// divergence counter for each compared state
+	class check_t
+	{
+		public:
+			check_t(const char *name)
+				: m_name(name)
+				, m_count(0)
+				, m_first("")
+			{
+			}
+
+			// returns false if diverged
+			bool check(bool equal, u32 step, const char *fmt, ...)
+			{
+				if (equal)
+				{
+					return true;
+				}
+				if (m_count++ == 0)
+				{
+					char line[256];
+					va_list args;
+					va_start(args, fmt);
+					std::vsnprintf(line, sizeof(line), fmt, args);
+					va_end(args);
+					m_first = "step " + std::to_string(step) + ", " + line;
+				}
+				return false;
+			}
+
+			void report()
+			{
+				std::printf("  %-16s %u divergent", m_name, m_count);
+				if (m_count != 0)
+				{
+					std::printf(", first at %s", m_first.c_str());
+				}
+				std::printf("\n");
+			}
+
+			inline u32 count() { return m_count; }
+
+		private:
+			const char *m_name = nullptr;  // compared state
+			u32 m_count		   = 0;		   // divergent steps or checks
+			std::string m_first;		   // first divergence
+	};
+
+	// index of first mismatch, or size if equal
+	size_t mismatch(const std::vector<s32> &a, const std::vector<s32> &b)
+	{
+		size_t i = 0;
+		while ((i < a.size()) && (i < b.size()) && (a[i] == b[i]))
+		{
+			i++;
+		}
+		return ((i == a.size()) && (i == b.size())) ? a.size() : i;
+	}
+
+	// tick reference until voice update or E rising edge, returns false if lost
+	template<typename T>
+	bool sync(typename T::core_t &core, bool update)
+	{
+		for (u32 t = 0; t < 256; t++)
+		{
+			core.tick();
+			if (update ? core.voice_update() : core.e_rising_edge())
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	// optimized path applies host write before both sample fetches of next voice,
+	// reference applies it between them; writes into next voice are skipped
+	template<typename T>
+	bool modeled(typename T::core_t &ref, u32 rnd)
+	{
+		const u8 page = u8(T::readback(ref, 0, 15));
+		return (T::global(rnd) || ((page & 0x1f) != ref.voice_cycle())) && T::modeled(rnd);
+	}
+
+	// run script for single chip, returns false if diverged
+	template<typename T>
+	bool run(const options_t &opt)
+	{
+		harness_intf ref_intf, perf_intf;
+		typename T::core_t ref(ref_intf), perf(perf_intf);
+		ref.reset();
+		perf.reset();
+
+		// align both cores at voice update
+		if (!sync<T>(ref, true))
+		{
+			std::printf("%s: reference voice update not found\n", T::name());
+			return false;
+		}
+		perf.tick_perf();
+
+		// chip configuration, applied at E rising edge
+		if (!sync<T>(ref, false))
+		{
+			std::printf("%s: reference E clock not found\n", T::name());
+			return false;
+		}
+		T::init(ref);
+		T::init(perf);
+		if (!sync<T>(ref, true))
+		{
+			std::printf("%s: reference voice update not found\n", T::name());
+			return false;
+		}
+		perf.tick_perf();
+
+		check_t voice_check("voice outputs"), ch_check("channel outputs"),
+		  read_check("host reads"), irq_check("IRQB callbacks"), reg_check("readback");
+		std::vector<s32> ref_voice, ref_ch, perf_voice, perf_ch;
+		rng_t rng(opt.seed);
+		u32 reads = 0, writes = 0;
+		for (u32 step = 0; step < opt.steps; step++)
+		{
+			ref_intf.set_step(step);
+			perf_intf.set_step(step);
+
+			// optional host access, 3/8 writes and 1/8 reads
+			const u32 op	 = rng.next();
+			const u32 rnd	 = rng.next();
+			const bool read	 = ((op & 7) == 7);
+			const bool write = ((op & 7) >= 4) && (!read);
+			if (read || (write && (opt.all_writes || modeled<T>(ref, rnd))))
+			{
+				// reference accepts it at E rising edge
+				if (!sync<T>(ref, false))
+				{
+					std::printf("%s: reference E clock lost at step %u\n", T::name(), step);
+					return false;
+				}
+				if (read)
+				{
+					const u32 r = T::read(ref, rnd);
+					const u32 p = T::read(perf, rnd);
+					read_check.check(r == p,
+									 step,
+									 "address %02x: reference %x, optimized %x",
+									 T::address(rnd),
+									 r,
+									 p);
+					reads++;
+				}
+				else
+				{
+					T::write(ref, rnd);
+					T::write(perf, rnd);
+					writes++;
+				}
+			}
+
+			// single voice update
+			if (!sync<T>(ref, true))
+			{
+				std::printf("%s: reference voice update lost at step %u\n", T::name(), step);
+				return false;
+			}
+			perf.tick_perf();
+
+			// outputs
+			T::outputs(ref, ref_voice, ref_ch);
+			T::outputs(perf, perf_voice, perf_ch);
+			size_t i = mismatch(ref_voice, perf_voice);
+			voice_check.check(i == ref_voice.size(),
+							  step,
+							  "output %u: reference %d, optimized %d",
+							  u32(i),
+							  (i < ref_voice.size()) ? ref_voice[i] : 0,
+							  (i < perf_voice.size()) ? perf_voice[i] : 0);
+			i = mismatch(ref_ch, perf_ch);
+			ch_check.check(i == ref_ch.size(),
+						   step,
+						   "channel %u: reference %d, optimized %d",
+						   u32(i),
+						   (i < ref_ch.size()) ? ref_ch[i] : 0,
+						   (i < perf_ch.size()) ? perf_ch[i] : 0);
+
+			// IRQB callbacks, same count and same last state
+			const std::vector<u64> &ref_irq	 = ref_intf.irq();
+			const std::vector<u64> &perf_irq = perf_intf.irq();
+			irq_check.check((ref_irq.size() == perf_irq.size()) &&
+							  (ref_irq.empty() || (ref_irq.back() == perf_irq.back())),
+							step,
+							"reference %u callbacks (last %s), optimized %u callbacks (last %s)",
+							u32(ref_irq.size()),
+							ref_irq.empty() ? "none" : ((ref_irq.back() & 1) ? "high" : "low"),
+							u32(perf_irq.size()),
+							perf_irq.empty() ? "none" : ((perf_irq.back() & 1) ? "high" : "low"));
+
+			// register readback
+			if ((opt.readback != 0) && ((step % opt.readback) == 0))
+			{
+				for (u32 page = 0; page < 0x80; page++)
+				{
+					for (u8 address = 0; address < 16; address++)
+					{
+						const u32 r = T::readback(ref, u8(page), address);
+						const u32 p = T::readback(perf, u8(page), address);
+						if (!reg_check.check(r == p,
+											 step,
+											 "page %02x register %u: reference %x, optimized %x",
+											 page,
+											 address,
+											 r,
+											 p))
+						{
+							page = 0x80;  // single divergence per check
+							break;
+						}
+					}
+				}
+			}
+		}
+
+		const u32 total = voice_check.count() + ch_check.count() + read_check.count() +
+						  irq_check.count() + reg_check.count();
+		std::printf("%s: seed %u, %u steps, %u writes, %u reads, %u IRQB callbacks, %s\n",
+					T::name(),
+					opt.seed,
+					opt.steps,
+					writes,
+					reads,
+					u32(ref_intf.irq().size()),
+					(total == 0) ? "no divergence" : "DIVERGED");
+		voice_check.report();
+		ch_check.report();
+		read_check.report();
+		irq_check.report();
+		reg_check.report();
+		return total == 0;
+	}
+
+	//-----------------------------------------------------------------
+	//
+	//	Block renderers
+	//
+	//-----------------------------------------------------------------
+
+	// Each traits class holds single core with its interface, both reference and optimized
+	// sides have own instance
+	// - name():							test name
+	// - channels:							outputs per sample, interleaved
+	// - set_step(step):					step number for recorded callbacks
+	// - write(rnd):						host access from script
+	// - reference(out, samples, rnd):		per-sample update, rnd is same for both sides
+	// - optimized(out, samples, rnd):		block renderer
+	// - state(out):						per-voice outputs and counters via getters
+	// - events():							recorded callbacks, step << 1 | state
+	// - registers(), readback(address):	register readback without side effects
+
+	// bitfield of script value
+	inline u32 field(u32 in, u8 pos, u8 len = 1) { return (in >> pos) & ((1u << len) - 1); }
+
+	// fractional clock accumulator, same as host rate renderers
+	class host_rate_t
+	{
+		public:
+			// clocks for next sample
+			inline u32 next(u32 clock, u32 rate)
+			{
+				m_frac			 += clock;
+				const u32 clocks = m_frac / rate;
+				m_frac			 %= rate;
+				return clocks;
+			}
+
+		private:
+			u32 m_frac = 0;	 // fraction of clock / rate
+	};
+
+	// host rates for host rate renderers, below and above clock of each voice slot
+	u32 host_rate(u32 rnd)
+	{
+		static const u32 rates[4] = {44100, 48000, 96000, 192000};
+		return rates[rnd & 3];
+	}
+
+	// interleave planar buffers
+	void interleave(s32 *out, const std::vector<std::vector<s32>> &buf, u32 samples)
+	{
+		const u32 channels = u32(buf.size());
+		for (u32 ch = 0; ch < channels; ch++)
+		{
+			for (u32 s = 0; s < samples; s++)
+			{
+				out[(s * channels) + ch] = buf[ch][s];
+			}
+		}
+	}
+
+	// sample memory with byte interface, filled from seed
+	class mem_harness_intf : public vgsound_emu_mem_intf
+	{
+		public:
+			mem_harness_intf(u32 size)
+				: vgsound_emu_mem_intf()
+				, m_mem(size)
+			{
+				rng_t rng(size);
+				for (u8 &elem : m_mem)
+				{
+					elem = u8(rng.next() >> 24);
+				}
+			}
+
+			virtual u8 read_byte(u32 address) override { return m_mem[address % m_mem.size()]; }
+
+			inline std::vector<u8> &mem() { return m_mem; }
+
+		private:
+			std::vector<u8> m_mem;	// sample memory
+	};
+
+	// no callbacks recorded
+	const std::vector<u64> &no_events()
+	{
+		static const std::vector<u64> events;
+		return events;
+	}
+
+	// ES5504 render_perf, against tick_perf
+	class es5504_render_traits
+	{
+		public:
+			static const u32 channels = 16;
+
+			es5504_render_traits()
+				: m_intf()
+				, m_core(m_intf)
+				, m_buf(channels)
+			{
+				m_core.reset();
+				// all voices are running and audible before script
+				rng_t rng(0x5504);
+				m_core.regs_w(0, 13, 24);
+				for (u8 v = 0; v < 25; v++)
+				{
+					for (u8 address = 0; address < 10; address++)
+					{
+						m_core.regs_w(v, address, u16(rng.next() >> 16));
+					}
+					m_core.regs_w(v, 0, 0x08);	// loop enable, not stopped
+					m_core.regs_w(v, 6, 0xfff0);
+					m_core.regs_w(v, 7, 0xfff0);
+				}
+			}
+
+			static const char *name() { return "ES5504 render_perf"; }
+
+			inline void set_step(u32 step) { m_intf.set_step(step); }
+
+			void write(u32 rnd) { m_core.host_w(rnd & 0xf, u16(rnd >> 16)); }
+
+			void reference(s32 *out, u32 samples, u32 rnd)
+			{
+				for (u32 s = 0; s < samples; s++)
+				{
+					m_core.tick_perf();
+					for (u8 ch = 0; ch < channels; ch++)
+					{
+						*out++ = m_core.out(ch);
+					}
+				}
+			}
+
+			void optimized(s32 *out, u32 samples, u32 rnd)
+			{
+				std::array<s32 *, 16> ptr;
+				for (u8 ch = 0; ch < channels; ch++)
+				{
+					m_buf[ch].resize(samples);
+					ptr[ch] = m_buf[ch].data();
+				}
+				m_core.render_perf(ptr.data(), samples);
+				interleave(out, m_buf, samples);
+			}
+
+			void state(std::vector<s32> &out)
+			{
+				out.clear();
+				for (u8 v = 0; v < 25; v++)
+				{
+					out.push_back(m_core.voice_out(v));
+				}
+				out.push_back(m_core.voice_cycle());
+			}
+
+			inline const std::vector<u64> &events() { return m_intf.irq(); }
+
+			static u32 registers() { return 0x800; }
+
+			u32 readback(u32 address) { return m_core.regs_r(address >> 4, address & 0xf, false); }
+
+		private:
+			harness_intf m_intf;					// sample memory and IRQB recorder
+			es5504_core m_core;						// core
+			std::vector<std::vector<s32>> m_buf;	// planar render buffer
+	};
+
+	// X1-010 render, against tick
+	class x1_010_traits
+	{
+		public:
+			static const u32 channels = 2;
+
+			x1_010_traits()
+				: m_intf(0x100000)
+				, m_core(m_intf)
+				, m_buf(channels)
+			{
+				m_core.reset();
+			}
+
+			static const char *name() { return "X1-010 render"; }
+
+			inline void set_step(u32 step) {}
+
+			// half of writes are into channel registers, others are into envelope and wavetable
+			void write(u32 rnd)
+			{
+				const u16 offset = field(rnd, 0) ? field(rnd, 1, 7) : field(rnd, 1, 13);
+				m_core.ram_w(offset, u8(rnd >> 16));
+			}
+
+			void reference(s32 *out, u32 samples, u32 rnd)
+			{
+				for (u32 s = 0; s < samples; s++)
+				{
+					m_core.tick();
+					*out++ = m_core.output(0);
+					*out++ = m_core.output(1);
+				}
+			}
+
+			void optimized(s32 *out, u32 samples, u32 rnd)
+			{
+				m_buf[0].resize(samples);
+				m_buf[1].resize(samples);
+				m_core.render(m_buf[0].data(), m_buf[1].data(), samples);
+				interleave(out, m_buf, samples);
+			}
+
+			void state(std::vector<s32> &out)
+			{
+				out.clear();
+				for (u8 v = 0; v < 16; v++)
+				{
+					out.push_back(m_core.voice_out(v, 0));
+					out.push_back(m_core.voice_out(v, 1));
+				}
+			}
+
+			inline const std::vector<u64> &events() { return no_events(); }
+
+			static u32 registers() { return 0x2000; }
+
+			u32 readback(u32 address) { return m_core.ram_r(u16(address)); }
+
+		private:
+			mem_harness_intf m_intf;				// sample memory
+			x1_010_core m_core;						// core
+			std::vector<std::vector<s32>> m_buf;	// planar render buffer
+	};
+
+	// Namco 163 render, each sample is single output update of tick
+	class n163_traits
+	{
+		public:
+			static const u32 channels = 1;
+
+			n163_traits()
+				: m_core()
+				, m_multiplex(true)
+				, m_disable(false)
+				, m_buf()
+			{
+				m_core.reset();
+				// voice registers and waveform are filled before script
+				rng_t rng(0x163);
+				for (u8 addr = 0; addr < 0x80; addr++)
+				{
+					m_core.addr_w(addr);
+					m_core.data_w(u8(rng.next() >> 24));
+				}
+			}
+
+			static const char *name() { return "N163 render"; }
+
+			inline void set_step(u32 step) {}
+
+			// most of writes are into voice registers, multiplex and disable are rarely changed
+			void write(u32 rnd)
+			{
+				if (field(rnd, 0, 6) == 0)
+				{
+					m_multiplex = field(rnd, 6);
+					m_core.set_multiplex(m_multiplex);
+				}
+				else if (field(rnd, 0, 6) == 1)
+				{
+					m_disable = (field(rnd, 6, 2) == 0);
+					m_core.set_disable(m_disable);
+				}
+				else
+				{
+					const u8 addr = field(rnd, 8, 7) | (field(rnd, 6) ? 0x40 : 0);
+					m_core.addr_w(addr);
+					m_core.data_w(u8(rnd >> 24));
+				}
+			}
+
+			void reference(s32 *out, u32 samples, u32 rnd)
+			{
+				for (u32 s = 0; s < samples; s++)
+				{
+					m_core.tick();
+					// demultiplexed output is updated after all active voices
+					if ((!m_multiplex) && (!m_disable))
+					{
+						while (m_core.voice_cycle() != 0x78)
+						{
+							m_core.tick();
+						}
+					}
+					*out++ = m_core.out();
+				}
+			}
+
+			void optimized(s32 *out, u32 samples, u32 rnd)
+			{
+				m_buf.resize(samples);
+				m_core.render(m_buf.data(), samples);
+				std::copy(m_buf.begin(), m_buf.end(), out);
+			}
+
+			void state(std::vector<s32> &out)
+			{
+				out.clear();
+				for (u8 v = 0; v < 8; v++)
+				{
+					out.push_back(m_core.voice_out(v));
+				}
+				out.push_back(m_core.voice_cycle());
+			}
+
+			inline const std::vector<u64> &events() { return no_events(); }
+
+			static u32 registers() { return 0x80; }
+
+			u32 readback(u32 address) { return m_core.reg(u8(address)); }
+
+		protected:
+			n163_core m_core;			 // core
+			bool m_multiplex = true;	 // multiplex flag, mirrored from script
+			bool m_disable	 = false;	 // disable flag, mirrored from script
+
+		private:
+			std::vector<s16> m_buf;	 // render buffer
+	};
+
+	// Namco 163 render at host rate, against tick
+	class n163_host_traits : public n163_traits
+	{
+		public:
+			static const u32 clock = 1789773;  // NTSC NES CPU clock
+
+			static const char *name() { return "N163 render (host rate)"; }
+
+			void reference(s32 *out, u32 samples, u32 rnd)
+			{
+				const u32 rate = host_rate(rnd);
+				for (u32 s = 0; s < samples; s++)
+				{
+					const u32 slots = m_rate.next(clock, rate * 15);
+					s32 sum			= 0;
+					for (u32 i = 0; i < slots; i++)
+					{
+						m_core.tick();
+						sum += m_core.out();
+					}
+					*out++ = slots ? ((sum * 256) / s32(slots)) : (m_core.out() * 256);
+				}
+			}
+
+			void optimized(s32 *out, u32 samples, u32 rnd)
+			{
+				m_core.render(out, samples, clock, host_rate(rnd));
+			}
+
+		private:
+			host_rate_t m_rate;	 // fractional clock accumulator of reference
+	};
+
+	// IRQ callback recorder
+	class vrcvi_harness_intf : public vrcvi_intf
+	{
+		public:
+			vrcvi_harness_intf()
+				: vrcvi_intf()
+				, m_step(0)
+				, m_irq()
+			{
+			}
+
+			virtual void irq_w(bool irq) override
+			{
+				m_irq.push_back((u64(m_step) << 1) | (irq ? 1 : 0));
+			}
+
+			inline void set_step(u32 step) { m_step = step; }
+
+			inline const std::vector<u64> &irq() { return m_irq; }
+
+		private:
+			u32 m_step = 0;			 // current step
+			std::vector<u64> m_irq;	 // IRQ callbacks, step << 1 | state
+	};
+
+	// Konami VRC VI render at host rate, against tick
+	class vrcvi_traits
+	{
+		public:
+			static const u32 channels = 1;
+			static const u32 clock	  = 1789773;  // NTSC NES CPU clock
+
+			vrcvi_traits()
+				: m_intf()
+				, m_core(m_intf)
+				, m_rate()
+			{
+				m_core.reset();
+			}
+
+			static const char *name() { return "VRC VI render"; }
+
+			inline void set_step(u32 step) { m_intf.set_step(step); }
+
+			void write(u32 rnd)
+			{
+				const u8 address = field(rnd, 8, 2) % 3;
+				const u8 data	 = u8(rnd >> 16);
+				switch (field(rnd, 0, 3))
+				{
+					case 0:
+					case 1:
+					case 2: m_core.pulse_w(field(rnd, 0), address, data); break;
+					case 3:
+					case 4:
+					case 5: m_core.saw_w(address, data); break;
+					case 6: m_core.timer_w(address, data); break;
+					default: m_core.control_w(data & 0x07); break;
+				}
+			}
+
+			void reference(s32 *out, u32 samples, u32 rnd)
+			{
+				const u32 rate = host_rate(rnd);
+				for (u32 s = 0; s < samples; s++)
+				{
+					const u32 clocks = m_rate.next(clock, rate);
+					s32 sum			 = 0;
+					for (u32 i = 0; i < clocks; i++)
+					{
+						m_core.tick();
+						sum += m_core.out();
+					}
+					*out++ = clocks ? ((sum * 256) / s32(clocks)) : (m_core.out() * 256);
+				}
+			}
+
+			void optimized(s32 *out, u32 samples, u32 rnd)
+			{
+				m_core.render(out, samples, clock, host_rate(rnd));
+			}
+
+			void state(std::vector<s32> &out)
+			{
+				out.clear();
+				out.push_back(m_core.pulse_out(0));
+				out.push_back(m_core.pulse_out(1));
+				out.push_back(m_core.sawtooth_out());
+				out.push_back(m_core.irq());
+				out.push_back(s32(m_core.irq_delay()));
+			}
+
+			inline const std::vector<u64> &events() { return m_intf.irq(); }
+
+			static u32 registers() { return 0; }
+
+			u32 readback(u32 address) { return 0; }
+
+		protected:
+			vrcvi_harness_intf m_intf;	// IRQ recorder
+			vrcvi_core m_core;			// core
+
+		private:
+			host_rate_t m_rate;	 // fractional clock accumulator of reference
+	};
+
+	// Konami VRC VI advance, each sample is output after random clocks
+	class vrcvi_advance_traits : public vrcvi_traits
+	{
+		public:
+			static const char *name() { return "VRC VI advance"; }
+
+			void reference(s32 *out, u32 samples, u32 rnd)
+			{
+				const u32 clocks = 1 + (rnd % 256);
+				for (u32 s = 0; s < samples; s++)
+				{
+					for (u32 i = 0; i < clocks; i++)
+					{
+						m_core.tick();
+					}
+					*out++ = m_core.out();
+				}
+			}
+
+			void optimized(s32 *out, u32 samples, u32 rnd)
+			{
+				const u32 clocks = 1 + (rnd % 256);
+				for (u32 s = 0; s < samples; s++)
+				{
+					m_core.advance(clocks);
+					*out++ = m_core.out();
+				}
+			}
+	};
+
+	// sample ROM with end markers for each NE
+	class k007232_harness_intf : public k007232_intf
+	{
+		public:
+			k007232_harness_intf()
+				: k007232_intf()
+				, m_rom{std::vector<u8>(0x20000), std::vector<u8>(0x20000)}
+			{
+				rng_t rng(0x7232);
+				for (std::vector<u8> &rom : m_rom)
+				{
+					for (u8 &elem : rom)
+					{
+						const u32 rnd = rng.next();
+						elem		  = u8(field(rnd, 0, 7) | ((field(rnd, 8, 9) == 0) ? 0x80 : 0));
+					}
+				}
+			}
+
+			virtual u8 read_sample(u8 ne, u32 address) override
+			{
+				return m_rom[ne & 1][address & 0x1ffff];
+			}
+
+			inline const std::vector<u8> &rom(u8 ne) { return m_rom[ne & 1]; }
+
+		private:
+			std::array<std::vector<u8>, 2> m_rom;  // sample ROM for each NE
+	};
+
+	// Konami K007232 render, against tick
+	class k007232_traits
+	{
+		public:
+			static const u32 channels = 2;
+
+			k007232_traits()
+				: m_intf()
+				, m_core(m_intf)
+				, m_lpan{0xff, 0xff}
+				, m_rpan{0xff, 0xff}
+				, m_buf(channels)
+			{
+				m_core.reset();
+				m_core.set_rom(0, m_intf.rom(0).data(), u32(m_intf.rom(0).size()));
+			}
+
+			static const char *name() { return "K007232 render"; }
+
+			inline void set_step(u32 step) {}
+
+			// pan is rarely changed
+			void write(u32 rnd)
+			{
+				if (field(rnd, 0, 4) == 0)
+				{
+					const u8 voice = field(rnd, 4);
+					m_lpan[voice]  = u8(rnd >> 16);
+					m_rpan[voice]  = u8(rnd >> 24);
+					m_core.set_pan(voice, m_lpan[voice], m_rpan[voice]);
+				}
+				else
+				{
+					m_core.write(field(rnd, 4, 4), u8(rnd >> 16));
+				}
+			}
+
+			void reference(s32 *out, u32 samples, u32 rnd)
+			{
+				for (u32 s = 0; s < samples; s++)
+				{
+					m_core.tick();
+					*out++ = m_core.output(0);
+					*out++ = m_core.output(1);
+				}
+			}
+
+			void optimized(s32 *out, u32 samples, u32 rnd)
+			{
+				m_buf[0].resize(samples);
+				m_buf[1].resize(samples);
+				s32 *buf[2] = {m_buf[0].data(), m_buf[1].data()};
+				m_core.render(buf, samples);
+				interleave(out, m_buf, samples);
+			}
+
+			void state(std::vector<s32> &out)
+			{
+				out.clear();
+				out.push_back(m_core.output(0));
+				out.push_back(m_core.output(1));
+			}
+
+			inline const std::vector<u64> &events() { return no_events(); }
+
+			static u32 registers() { return 0x10; }
+
+			u32 readback(u32 address) { return m_core.reg_r(u8(address)); }
+
+		protected:
+			k007232_harness_intf m_intf;	  // sample ROM
+			k007232_core m_core;			  // core
+			std::array<u8, 2> m_lpan = {0};	  // left pan, mirrored from script
+			std::array<u8, 2> m_rpan = {0};	  // right pan, mirrored from script
+
+		private:
+			std::vector<std::vector<s32>> m_buf;  // planar render buffer
+	};
+
+	// Konami K007232 render_stereo, against tick with level stage
+	class k007232_stereo_traits : public k007232_traits
+	{
+		public:
+			static const char *name() { return "K007232 render_stereo"; }
+
+			void reference(s32 *out, u32 samples, u32 rnd)
+			{
+				const u8 level = m_core.reg_r(0xc);
+				for (u32 s = 0; s < samples; s++)
+				{
+					m_core.tick();
+					const s32 out0 = m_core.output(0) * field(level, 0, 4);
+					const s32 out1 = m_core.output(1) * field(level, 4, 4);
+					*out++		   = (out0 * m_lpan[0]) + (out1 * m_lpan[1]);
+					*out++		   = (out0 * m_rpan[0]) + (out1 * m_rpan[1]);
+				}
+			}
+
+			void optimized(s32 *out, u32 samples, u32 rnd) { m_core.render_stereo(out, samples); }
+	};
+
+	// Konami K005289 with Bubble System latches, render at host rate against tick
+	class k005289_traits
+	{
+		public:
+			static const u32 channels = 1;
+			static const u32 clock	  = 3072000;  // Bubble System K005289 clock
+
+			k005289_traits()
+				: m_core()
+				, m_rate()
+			{
+				rng_t rng(0x5289);
+				std::array<u8, 0x200> prom;
+				for (u8 &elem : prom)
+				{
+					elem = u8(rng.next() >> 24);
+				}
+				m_core.set_prom(prom.data());
+				m_core.reset();
+			}
+
+			static const char *name() { return "K005289 render"; }
+
+			inline void set_step(u32 step) {}
+
+			void write(u32 rnd)
+			{
+				const int voice = field(rnd, 2);
+				switch (field(rnd, 0, 2))
+				{
+					case 0: m_core.load(voice, field(rnd, 16, 12)); break;
+					case 1: m_core.update(voice); break;
+					default: m_core.control_w(voice, u8(rnd >> 16)); break;
+				}
+			}
+
+			void reference(s32 *out, u32 samples, u32 rnd)
+			{
+				const u32 rate = host_rate(rnd);
+				for (u32 s = 0; s < samples; s++)
+				{
+					const u32 clocks = m_rate.next(clock, rate);
+					s32 sum			 = 0;
+					for (u32 i = 0; i < clocks; i++)
+					{
+						m_core.tick();
+						sum += m_core.out();
+					}
+					*out++ = clocks ? ((sum * 256) / s32(clocks)) : (m_core.out() * 256);
+				}
+			}
+
+			void optimized(s32 *out, u32 samples, u32 rnd)
+			{
+				m_core.render(out, samples, clock, host_rate(rnd));
+			}
+
+			void state(std::vector<s32> &out)
+			{
+				out.clear();
+				for (int v = 0; v < 2; v++)
+				{
+					out.push_back(m_core.addr(v));
+					out.push_back(m_core.voice_out(v));
+				}
+			}
+
+			inline const std::vector<u64> &events() { return no_events(); }
+
+			static u32 registers() { return 0; }
+
+			u32 readback(u32 address) { return 0; }
+
+		private:
+			k005289_bubble_core m_core;	 // core
+			host_rate_t m_rate;			 // fractional clock accumulator of reference
+	};
+
+	// OKI MSM6295 render, against tick
+	class msm6295_traits
+	{
+		public:
+			static const u32 channels = 1;
+
+			msm6295_traits()
+				: m_intf(0x40000)
+				, m_core(m_intf)
+				, m_ss(false)
+			{
+				// phrase table with short phrases
+				rng_t rng(0x6295);
+				std::vector<u8> &mem = m_intf.mem();
+				for (u32 phrase = 0; phrase < 0x80; phrase++)
+				{
+					const u32 start = 0x400 + (rng.next() % 0x3f000);
+					const u32 end	= start + 0x10 + (rng.next() % 0x800);
+					for (u32 i = 0; i < 3; i++)
+					{
+						mem[(phrase << 3) | i]		 = u8(start >> (16 - (i << 3)));
+						mem[(phrase << 3) | (3 + i)] = u8(end >> (16 - (i << 3)));
+					}
+				}
+				for (u8 page = 0; page < 16; page += 2)
+				{
+					m_core.set_bank(page, &mem[u32(page) << 14]);
+				}
+				m_core.reset();
+			}
+
+			static const char *name() { return "MSM6295 render"; }
+
+			inline void set_step(u32 step) {}
+
+			// play command is written as pair, SS pin is rarely changed
+			// cores are ticked before write, so sample alignment of render is moved
+			void write(u32 rnd)
+			{
+				const u8 data = u8(rnd >> 16);
+				for (u32 i = field(rnd, 24, 8); i > 0; i--)
+				{
+					m_core.tick();
+				}
+				switch (field(rnd, 0, 4))
+				{
+					case 0:
+						m_ss = field(rnd, 4);
+						m_core.ss_w(m_ss);
+						break;
+					case 1:
+					case 2:
+					case 3:	 // suspend
+						m_core.command_w(data & 0x78);
+						break;
+					default:  // play
+						m_core.command_w(0x80 | data);
+						m_core.command_w((0x10 << field(rnd, 4, 2)) | field(rnd, 8, 4));
+						break;
+				}
+			}
+
+			void reference(s32 *out, u32 samples, u32 rnd)
+			{
+				const u32 ticks = 33 * (m_ss ? 5 : 4);
+				for (u32 s = 0; s < samples; s++)
+				{
+					for (u32 i = 0; i < ticks; i++)
+					{
+						m_core.tick();
+					}
+					*out++ = m_core.out();
+				}
+			}
+
+			void optimized(s32 *out, u32 samples, u32 rnd) { m_core.render(out, samples); }
+
+			void state(std::vector<s32> &out)
+			{
+				out.clear();
+				for (u8 v = 0; v < 4; v++)
+				{
+					out.push_back(m_core.voice_out(v));
+				}
+			}
+
+			inline const std::vector<u64> &events() { return no_events(); }
+
+			static u32 registers() { return 1; }
+
+			u32 readback(u32 address) { return m_core.busy_r(); }
+
+		private:
+			mem_harness_intf m_intf;  // sample memory
+			msm6295_core m_core;	  // core
+			bool m_ss = false;		  // SS pin, mirrored from script
+	};
+
+	// run block renderer script for single core, returns false if diverged
+	template<typename T>
+	bool run_block(const options_t &opt)
+	{
+		T ref, perf;
+		check_t out_check("outputs"), state_check("voice states"), event_check("callbacks"),
+		  reg_check("readback");
+		std::vector<s32> ref_out, perf_out, ref_state, perf_state;
+		rng_t rng(opt.seed);
+		u32 writes = 0;
+		u64 total  = 0;
+		for (u32 step = 0; step < opt.blocks; step++)
+		{
+			ref.set_step(step);
+			perf.set_step(step);
+
+			// optional host access, 1/2 of steps
+			const u32 op  = rng.next();
+			const u32 rnd = rng.next();
+			if (field(op, 0))
+			{
+				ref.write(rnd);
+				perf.write(rnd);
+				writes++;
+			}
+
+			// block of random length
+			const u32 samples = 1 + ((op >> 8) % std::max<u32>(1, opt.length));
+			const u32 block	  = rng.next();
+			ref_out.assign(samples * T::channels, 0);
+			perf_out.assign(samples * T::channels, 0);
+			ref.reference(ref_out.data(), samples, block);
+			perf.optimized(perf_out.data(), samples, block);
+			total += samples;
+
+			size_t i = mismatch(ref_out, perf_out);
+			out_check.check(i == ref_out.size(),
+							step,
+							"sample %u of %u, channel %u: reference %d, optimized %d",
+							u32(i / T::channels),
+							samples,
+							u32(i % T::channels),
+							(i < ref_out.size()) ? ref_out[i] : 0,
+							(i < perf_out.size()) ? perf_out[i] : 0);
+
+			ref.state(ref_state);
+			perf.state(perf_state);
+			i = mismatch(ref_state, perf_state);
+			state_check.check(i == ref_state.size(),
+							  step,
+							  "state %u: reference %d, optimized %d",
+							  u32(i),
+							  (i < ref_state.size()) ? ref_state[i] : 0,
+							  (i < perf_state.size()) ? perf_state[i] : 0);
+
+			// callbacks, same count and same last state
+			const std::vector<u64> &ref_events	= ref.events();
+			const std::vector<u64> &perf_events = perf.events();
+			event_check.check((ref_events.size() == perf_events.size()) &&
+								(ref_events.empty() || (ref_events.back() == perf_events.back())),
+							  step,
+							  "reference %u callbacks, optimized %u callbacks",
+							  u32(ref_events.size()),
+							  u32(perf_events.size()));
+
+			// register readback
+			if ((opt.readback != 0) && ((step % opt.readback) == 0))
+			{
+				for (u32 address = 0; address < T::registers(); address++)
+				{
+					const u32 r = ref.readback(address);
+					const u32 p = perf.readback(address);
+					if (!reg_check.check(r == p,
+										 step,
+										 "register %x: reference %x, optimized %x",
+										 address,
+										 r,
+										 p))
+					{
+						break;	// single divergence per check
+					}
+				}
+			}
+		}
+
+		const u32 diverged =
+		  out_check.count() + state_check.count() + event_check.count() + reg_check.count();
+		std::printf("%s: seed %u, %u blocks, %llu samples, %u writes, %u callbacks, %s\n",
+					T::name(),
+					opt.seed,
+					opt.blocks,
+					total,
+					writes,
+					u32(ref.events().size()),
+					(diverged == 0) ? "no divergence" : "DIVERGED");
+		out_check.report();
+		state_check.report();
+		event_check.report();
+		reg_check.report();
+		return diverged == 0;
+	}
+
+	void usage()
+	{
+		std::fprintf(stderr,
+					 "usage: core_diff [-c chip|all] [-s seed] [-n steps] [-b steps] [-l len] "
+					 "[-r steps] [-a 0|1]\n"
+					 "chips: 5504 5505 5506 5504p x1_010 n163 n163h vrcvi vrcvia k007232 "
+					 "k007232s k005289 msm6295\n");
+	}
+}  // namespace
+
+int main(int argc, char **argv)
+{
+	options_t opt;
+	for (int i = 1; i < argc; i++)
+	{
+		const std::string arg = argv[i];
+		if ((arg.size() == 2) && (arg[0] == '-') && ((i + 1) < argc))
+		{
+			const std::string value = argv[++i];
+			switch (arg[1])
+			{
+				case 'c': opt.chip = value; break;
+				case 's': opt.seed = u32(std::strtoul(value.c_str(), nullptr, 0)); break;
+				case 'n': opt.steps = u32(std::strtoul(value.c_str(), nullptr, 0)); break;
+				case 'b': opt.blocks = u32(std::strtoul(value.c_str(), nullptr, 0)); break;
+				case 'l': opt.length = u32(std::strtoul(value.c_str(), nullptr, 0)); break;
+				case 'r': opt.readback = u32(std::strtoul(value.c_str(), nullptr, 0)); break;
+				case 'a': opt.all_writes = (value != "0"); break;
+				default: usage(); return 1;
+			}
+		}
+		else
+		{
+			usage();
+			return 1;
+		}
+	}
+
+	// test name and runner for each test
+	struct test_t
+	{
+			const char *chip;
+			bool (*run)(const options_t &opt);
+	};
+
+	static const test_t tests[] = {
+	  {"5504", run<es5504_traits>},
+	  {"5505", run<es5505_traits>},
+	  {"5506", run<es5506_traits>},
+	  {"5504p", run_block<es5504_render_traits>},
+	  {"x1_010", run_block<x1_010_traits>},
+	  {"n163", run_block<n163_traits>},
+	  {"n163h", run_block<n163_host_traits>},
+	  {"vrcvi", run_block<vrcvi_traits>},
+	  {"vrcvia", run_block<vrcvi_advance_traits>},
+	  {"k007232", run_block<k007232_traits>},
+	  {"k007232s", run_block<k007232_stereo_traits>},
+	  {"k005289", run_block<k005289_traits>},
+	  {"msm6295", run_block<msm6295_traits>},
+	};
+
+	const bool all = (opt.chip == "all");
+	bool found	   = false;
+	bool pass	   = true;
+	for (const test_t &test : tests)
+	{
+		if (all || (opt.chip == test.chip))
+		{
+			found = true;
+			pass  = test.run(opt) && pass;
+		}
+	}
+	if (!found)
+	{
+		usage();
+		return 1;
+	}
+	return pass ? 0 : 1;
+}
@@ -0,0 +1,206 @@
+/*
+	License: Zlib
+	see https://gitlab.com/cam900/vgsound_emu/-/blob/main/LICENSE for more details
+
+	Copyright holder(s): cam900
+	Register trace recorder and replayer
+
+	record: plays VGM log and records every host accesses of chips into trace.
+	play:   replays trace at maximum speed, and reports real-time factor.
+
+	Both modes report hash of rendered output, so replayed output can be
+   compared with recorded session. Host reads different from trace are also
+   reported in play mode.
+
+	Usage:
+	trace_tool record [options] input.vgm output.vgtr
+	trace_tool play [options] input.vgtr
+
+	Options:
+	-r rate  Output sample rate for record (default: 44100)
+	-l loops Loop count for record (default: 0)
+	-t secs  Maximum length in seconds for record (default: 600)
+	-n count Repeat count for play (default: 1)
+
+	Build (from repository root):
+	cmake -S . -B build && cmake --build build --target trace_tool
+*/
+
+#include "../board/board_trace.hpp"
+#include "../vgm/vgm.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+namespace
+{
+	struct options_t
+	{
+			u32 rate		= 44100;  // output sample rate
+			u32 loops		= 0;	  // loop count
+			u32 max_seconds = 600;	  // maximum length
+			u32 repeat		= 1;	  // replay count
+	};
+
+	// FNV-1a hash of output
+	class hash_t
+	{
+		public:
+			void update(const s32 *in, u32 samples)
+			{
+				for (u32 i = 0; i < (samples << 1); i++)
+				{
+					for (u8 b = 0; b < 4; b++)
+					{
+						m_hash = (m_hash ^ ((u32(in[i]) >> (b << 3)) & 0xff)) * 0x100000001b3ULL;
+					}
+				}
+			}
+
+			inline u64 hash() { return m_hash; }
+
+		private:
+			u64 m_hash = 0xcbf29ce484222325ULL;	 // current hash
+	};
+
+	const u32 block = 0x1000;
+
+	int record(const options_t &opt, const std::string &input, const std::string &output)
+	{
+		vgm_file_reader reader;
+		vgm_player_core player(opt.rate);
+		if ((!reader.open(input)) || (!player.open(reader)))
+		{
+			std::fprintf(stderr, "%s: can't open\n", input.c_str());
+			return 1;
+		}
+		player.set_loops(opt.loops);
+
+		// start trace before reset, for recording initial state
+		board_trace_writer trace;
+		player.board().set_trace(&trace);
+		player.reset();
+
+		const u64 limit = u64(opt.max_seconds) * opt.rate;
+		std::vector<s32> buf(block << 1);
+		hash_t hash;
+		u64 samples = 0;
+		while (samples < limit)
+		{
+			const u32 len	   = u32(std::min<u64>(block, limit - samples));
+			const u32 rendered = player.render(buf.data(), len);
+			hash.update(buf.data(), rendered);
+			samples += rendered;
+			if (rendered < len)
+			{
+				break;
+			}
+		}
+		player.board().set_trace(nullptr);
+
+		if (!trace.save(output))
+		{
+			std::fprintf(stderr, "%s: can't create\n", output.c_str());
+			return 1;
+		}
+		std::printf("%s: %llu samples, %llu events, %u bytes, hash %016llx\n",
+					output.c_str(),
+					samples,
+					trace.events(),
+					u32(trace.data().size()),
+					hash.hash());
+		return 0;
+	}
+
+	int play(const options_t &opt, const std::string &input)
+	{
+		board_trace_player player;
+		if (!player.load(input))
+		{
+			std::fprintf(stderr, "%s: not a trace file\n", input.c_str());
+			return 1;
+		}
+
+		std::vector<s32> buf(block << 1);
+		for (u32 r = 0; r < opt.repeat; r++)
+		{
+			const auto begin = std::chrono::steady_clock::now();
+			player.reset();
+			hash_t hash;
+			u64 samples = 0;
+			u32 rendered;
+			do
+			{
+				rendered = player.render(buf.data(), block);
+				hash.update(buf.data(), rendered);
+				samples += rendered;
+			} while (rendered == block);
+
+			const f64 wall =
+			  std::chrono::duration<f64>(std::chrono::steady_clock::now() - begin).count();
+			const f64 length = f64(samples) / f64(player.rate());
+			std::printf(
+			  "%s: %llu samples, %llu events, %llu read mismatches, hash %016llx, RTF %.1fx\n",
+			  input.c_str(),
+			  samples,
+			  player.events(),
+			  player.mismatch(),
+			  hash.hash(),
+			  (wall > 0.0) ? (length / wall) : 0.0);
+		}
+		return 0;
+	}
+
+	void usage()
+	{
+		std::fprintf(stderr,
+					 "usage: trace_tool record [-r rate] [-l loops] [-t secs] input.vgm "
+					 "output.vgtr\n"
+					 "       trace_tool play [-n count] input.vgtr\n");
+	}
+}  // namespace
+
+int main(int argc, char **argv)
+{
+	if (argc < 2)
+	{
+		usage();
+		return 1;
+	}
+
+	const std::string mode = argv[1];
+	options_t opt;
+	std::vector<std::string> files;
+	for (int i = 2; i < argc; i++)
+	{
+		const std::string arg = argv[i];
+		if ((arg.size() == 2) && (arg[0] == '-') && ((i + 1) < argc))
+		{
+			const u32 value = u32(std::strtoul(argv[++i], nullptr, 0));
+			switch (arg[1])
+			{
+				case 'r': opt.rate = value; break;
+				case 'l': opt.loops = value; break;
+				case 't': opt.max_seconds = value; break;
+				case 'n': opt.repeat = value; break;
+				default: usage(); return 1;
+			}
+		}
+		else
+		{
+			files.push_back(arg);
+		}
+	}
+
+	if ((mode == "record") && (files.size() == 2) && (opt.rate != 0))
+	{
+		return record(opt, files[0], files[1]);
+	}
+	if ((mode == "play") && (files.size() == 1))
+	{
+		return play(opt, files[0]);
+	}
+	usage();
+	return 1;
+}
@@ -0,0 +1,640 @@
+/*
+	License: Zlib
+	see https://gitlab.com/cam900/vgsound_emu/-/blob/main/LICENSE for more details
+
+	Copyright holder(s): cam900
+	Streaming VGM log player
+
+	It maps VGM commands into emulation cores in this repository, and renders
+   them via board (see board.cpp).
+
+	Command stream is read from reader interface with 64KB buffer, so whole
+   file is not needed in memory; file reader and memory reader (also usable
+   for memory mapped file) are included. Compressed VGM (.vgz) is not
+   supported, it must be decompressed before playback.
+
+	Commands are executed until wait command, and then every attached chips
+   are advanced in single run until next command.
+
+	Supported chips:
+
+	Header Clock             Chip
+	0x98   bit 31: SS pin    OKI MSM6295
+	0x9c   bit 31: K052539   Konami K051649/K052539 SCC
+	0xac                     Konami K053260
+	0xd0   bit 31: ES5506    Ensoniq ES5505/ES5506
+	0xd8                     Seta/Allumer X1-010
+
+	bit 30 of clock is dual chip flag.
+
+	Commands:
+
+	Command       Description
+	0x61 nn nn    Wait n samples
+	0x62          Wait 735 samples
+	0x63          Wait 882 samples
+	0x66          End of sound data
+	0x67          Data block
+	0x7n          Wait n+1 samples
+	0x8n          YM2612 DAC write and wait n samples (only wait is executed)
+	0xb8 aa dd    MSM6295 register aa (bit 7: second chip)
+	              0x00: Command
+	              0x08-0x0b: Clock (bit 0-7...bit 24-31)
+	              0x0c: SS pin
+	              0x0e: NMK112 mode (bit 7: paged phrase table)
+	              0x0f-0x12: NMK112 bank 0-3
+	0xba aa dd    K053260 register aa (bit 7: second chip)
+	0xbe aa dd    ES5506 host address aa (bit 7: second chip)
+	0xc8 mmll dd  X1-010 RAM offset mmll, high byte first (bit 15: second chip)
+	0xd2 pp aa dd SCC port pp (bit 7: second chip), register aa
+	              0x00: Waveform
+	              0x01: Frequency
+	              0x02: Volume
+	              0x03: Key on/off
+	              0x04: Waveform (SCC+)
+	              0x05: Test register
+	0xd6 aa ddee  ES5505 host address aa (bit 7: second chip), data ddee
+
+	Other commands are skipped.
+
+	ROM data blocks (type 0x80-0xbf):
+
+	Type Chip
+	0x8b OKI MSM6295
+	0x8e Konami K053260
+	0x90 Ensoniq ES5505/ES5506, bit 28-31 of start address is bank
+	0x91 Seta/Allumer X1-010
+
+	Data blocks are stored into ROM buffers of each chip and regions, and they
+   are attached to chips directly.
+
+	Konami K007232 has no VGM command and header field, it can be driven with
+   board_k007232_device directly.
+*/
+
+#include "vgm.hpp"
+
+// VGM file
+bool vgm_file_reader::open(const std::string &path)
+{
+	close();
+	m_file = std::fopen(path.c_str(), "rb");
+	return m_file != nullptr;
+}
+
+void vgm_file_reader::close()
+{
+	if (m_file != nullptr)
+	{
+		std::fclose(m_file);
+		m_file = nullptr;
+	}
+}
+
+u32 vgm_file_reader::read(u8 *data, u32 size)
+{
+	return (m_file != nullptr) ? u32(std::fread(data, 1, size, m_file)) : 0;
+}
+
+bool vgm_file_reader::seek(u32 offset)
+{
+	return (m_file != nullptr) && (std::fseek(m_file, long(offset), SEEK_SET) == 0);
+}
+
+// VGM in memory
+u32 vgm_memory_reader::read(u8 *data, u32 size)
+{
+	size = std::min<u32>(size, m_size - m_pos);
+	std::copy_n(m_data + m_pos, size, data);
+	m_pos += size;
+	return size;
+}
+
+bool vgm_memory_reader::seek(u32 offset)
+{
+	m_pos = std::min<u32>(offset, m_size);
+	return offset <= m_size;
+}
+
+// VGM player
+bool vgm_player_core::open(vgm_reader_intf &reader)
+{
+	close();
+
+	// read header
+	std::array<u8, 0x100> header;
+	header.fill(0);
+	reader.seek(0);
+	const u32 header_size = reader.read(header.data(), 0x100);
+	if ((header_size < 0x40) || (header[0] != 'V') || (header[1] != 'g') || (header[2] != 'm') ||
+		(header[3] != ' '))
+	{
+		return false;
+	}
+
+	auto header_r = [&header](u32 offset) -> u32
+	{
+		return header[offset] | (u32(header[offset + 1]) << 8) |
+			   (u32(header[offset + 2]) << 16) | (u32(header[offset + 3]) << 24);
+	};
+
+	m_version	  = header_r(0x08);
+	m_data_offset = 0x40;
+	if ((m_version >= 0x150) && (header_r(0x34) != 0))
+	{
+		m_data_offset = 0x34 + header_r(0x34);
+	}
+
+	// fields after start of command stream are not exists
+	if (m_data_offset < 0x100)
+	{
+		std::fill(header.begin() + m_data_offset, header.end(), 0);
+	}
+
+	m_eof_offset	= (header_r(0x04) != 0) ? (0x04 + header_r(0x04)) : ~0U;
+	m_loop_offset	= (header_r(0x1c) != 0) ? (0x1c + header_r(0x1c)) : 0;
+	m_total_samples = header_r(0x18);
+	m_loop_samples	= header_r(0x20);
+
+	// attach chips
+	const u32 msm6295_clock = header_r(0x98);
+	const u32 scc_clock		= header_r(0x9c);
+	const u32 k053260_clock = header_r(0xac);
+	const u32 es550x_clock	= header_r(0xd0);
+	const u32 x1_010_clock	= header_r(0xd8);
+	m_msm6295_init			= msm6295_clock;
+	m_es5506				= bitfield(es550x_clock, 31);
+	auto exists = [this](u32 clock, u8 index) -> bool
+	{ return (clock != 0) && ((index == 0) || bitfield(clock, 30)); };
+	for (u8 i = 0; i < 2; i++)
+	{
+		if (exists(msm6295_clock, i))
+		{
+			const u32 clock = bitfield(msm6295_clock, 0, 30);
+			const bool ss	= bitfield(msm6295_clock, 31);
+			m_device[CHIP_MSM6295][i].reset(new board_msm6295_device(clock, ss));
+		}
+		if (exists(scc_clock, i))
+		{
+			const u32 clock = bitfield(scc_clock, 0, 30);
+			m_device[CHIP_SCC][i].reset(new board_scc_device(clock, bitfield(scc_clock, 31)));
+		}
+		if (exists(k053260_clock, i))
+		{
+			const u32 clock = bitfield(k053260_clock, 0, 30);
+			m_device[CHIP_K053260][i].reset(new board_k053260_device(clock));
+		}
+		if (exists(es550x_clock, i))
+		{
+			const u32 clock = bitfield(es550x_clock, 0, 30);
+			if (m_es5506)
+			{
+				m_device[CHIP_ES550X][i].reset(new board_es5506_device(clock));
+			}
+			else
+			{
+				m_device[CHIP_ES550X][i].reset(new board_es5505_device(clock));
+			}
+		}
+		if (exists(x1_010_clock, i))
+		{
+			const u32 clock = bitfield(x1_010_clock, 0, 30);
+			m_device[CHIP_X1_010][i].reset(new board_x1_010_device(clock));
+		}
+	}
+
+	for (auto &chip : m_device)
+	{
+		for (auto &elem : chip)
+		{
+			if (elem != nullptr)
+			{
+				m_board.attach(*elem);
+			}
+		}
+	}
+
+	m_reader = &reader;
+	reset();
+	return true;
+}
+
+void vgm_player_core::close()
+{
+	m_board.detach_all();
+	for (auto &chip : m_device)
+	{
+		for (auto &elem : chip)
+		{
+			elem.reset();
+		}
+	}
+	m_rom.clear();
+	m_reader		= nullptr;
+	m_buf_base		= 0;
+	m_buf_pos		= 0;
+	m_buf_len		= 0;
+	m_version		= 0;
+	m_data_offset	= 0;
+	m_eof_offset	= 0;
+	m_loop_offset	= 0;
+	m_total_samples = 0;
+	m_loop_samples	= 0;
+	m_es5506		= false;
+	m_msm6295_init	= 0;
+	m_ended			= true;
+}
+
+void vgm_player_core::reset()
+{
+	if (m_reader == nullptr)
+	{
+		return;
+	}
+
+	m_board.reset();
+	for (u8 i = 0; i < 2; i++)
+	{
+		// clock and SS pin are changeable by command
+		board_msm6295_device *msm6295 =
+		  static_cast<board_msm6295_device *>(m_device[CHIP_MSM6295][i].get());
+		m_msm6295_clock[i] = bitfield(m_msm6295_init, 0, 30);
+		if (msm6295 != nullptr)
+		{
+			msm6295->set_clock(m_msm6295_clock[i]);
+			msm6295->set_ss(bitfield(m_msm6295_init, 31));
+		}
+	}
+	m_buf_base	 = 0;
+	m_buf_pos	 = 0;
+	m_buf_len	 = 0;
+	m_loop_count = 0;
+	m_ended		 = false;
+	m_time		 = 0;
+	m_out_time	 = 0;
+	seek(m_data_offset);
+}
+
+u32 vgm_player_core::render(s32 *out, u32 samples)
+{
+	u32 done = 0;
+	while (done < samples)
+	{
+		const u64 target = (m_time * m_board.rate()) / 44100;
+		if (target <= m_out_time)
+		{
+			if (!execute())
+			{
+				break;
+			}
+			continue;
+		}
+
+		// advance every chips until next command
+		const u32 len = u32(std::min<u64>(target - m_out_time, samples - done));
+		m_board.render(out + (done << 1), len);
+		m_out_time += len;
+		done	   += len;
+	}
+
+	if (done < samples)
+	{
+		std::fill_n(out + (done << 1), (samples - done) << 1, 0);
+	}
+	return done;
+}
+
+// execute commands until wait, returns false if stream is ended
+bool vgm_player_core::execute()
+{
+	while (!m_ended)
+	{
+		if (tell() >= m_eof_offset)
+		{
+			end_of_data();
+			continue;
+		}
+
+		const u8 command = fetch();
+		switch (command)
+		{
+			case 0x61:	// wait n samples
+				m_time += fetch_le(2);
+				return true;
+			case 0x62:	// wait 735 samples (1/60 second)
+				m_time += 735;
+				return true;
+			case 0x63:	// wait 882 samples (1/50 second)
+				m_time += 882;
+				return true;
+			case 0x66:	// end of sound data
+				end_of_data();
+				break;
+			case 0x67:	// data block
+				data_block();
+				break;
+			case 0x68:	// PCM RAM write
+				skip(11);
+				break;
+			case 0xb8:	// MSM6295
+			{
+				const u8 address = fetch();
+				const u8 data	 = fetch();
+				msm6295_w(bitfield(address, 7), bitfield(address, 0, 7), data);
+				break;
+			}
+			case 0xba:	// K053260
+			{
+				const u8 address  = fetch();
+				const u8 data	  = fetch();
+				board_device *dev = m_device[CHIP_K053260][bitfield(address, 7)].get();
+				if (dev != nullptr)
+				{
+					dev->write(bitfield(address, 0, 7), data);
+				}
+				break;
+			}
+			case 0xbe:	// ES5506, 8 bit
+			{
+				const u8 address  = fetch();
+				const u8 data	  = fetch();
+				board_device *dev = m_device[CHIP_ES550X][bitfield(address, 7)].get();
+				if ((dev != nullptr) && m_es5506)
+				{
+					dev->write(bitfield(address, 0, 7), data);
+				}
+				break;
+			}
+			case 0xc8:	// X1-010
+			{
+				const u8 hi		  = fetch();
+				const u8 lo		  = fetch();
+				const u8 data	  = fetch();
+				board_device *dev = m_device[CHIP_X1_010][bitfield(hi, 7)].get();
+				if (dev != nullptr)
+				{
+					dev->write((u32(bitfield(hi, 0, 7)) << 8) | lo, data);
+				}
+				break;
+			}
+			case 0xd2:	// SCC
+			{
+				const u8 port	 = fetch();
+				const u8 address = fetch();
+				const u8 data	 = fetch();
+				scc_w(bitfield(port, 7), bitfield(port, 0, 7), address, data);
+				break;
+			}
+			case 0xd6:	// ES5505, 16 bit
+			{
+				const u8 address  = fetch();
+				const u8 hi		  = fetch();
+				const u8 lo		  = fetch();
+				board_device *dev = m_device[CHIP_ES550X][bitfield(address, 7)].get();
+				if ((dev != nullptr) && (!m_es5506))
+				{
+					dev->write(bitfield(address, 0, 7), (u32(hi) << 8) | lo);
+				}
+				break;
+			}
+			default:
+				if ((command >= 0x70) && (command <= 0x7f))
+				{  // wait n+1 samples
+					m_time += bitfield(command, 0, 4) + 1;
+					return true;
+				}
+				else if ((command >= 0x80) && (command <= 0x8f))
+				{  // YM2612 DAC write and wait n samples
+					if (bitfield(command, 0, 4) != 0)
+					{
+						m_time += bitfield(command, 0, 4);
+						return true;
+					}
+				}
+				else if ((command >= 0x30) && (command <= 0x3f))
+				{
+					skip(1);
+				}
+				else if (((command >= 0x40) && (command <= 0x4e)) ||
+						 ((command >= 0x51) && (command <= 0x5f)) ||
+						 ((command >= 0xa0) && (command <= 0xbf)))
+				{
+					skip(2);
+				}
+				else if ((command == 0x4f) || (command == 0x50) || (command == 0x94))
+				{
+					skip(1);
+				}
+				else if ((command >= 0xc0) && (command <= 0xdf))
+				{
+					skip(3);
+				}
+				else if ((command >= 0xe0) || (command == 0x90) || (command == 0x91) ||
+						 (command == 0x95))
+				{
+					skip(4);
+				}
+				else if (command == 0x92)
+				{
+					skip(5);
+				}
+				else if (command == 0x93)
+				{
+					skip(10);
+				}
+				break;
+		}
+	}
+	return false;
+}
+
+void vgm_player_core::end_of_data()
+{
+	// loop without length is ignored, for avoid infinite loop
+	if ((m_loop_offset != 0) && (m_loop_samples != 0) &&
+		((m_loops == ~0U) || (m_loop_count < m_loops)))
+	{
+		m_loop_count++;
+		seek(m_loop_offset);
+	}
+	else
+	{
+		m_ended = true;
+	}
+}
+
+void vgm_player_core::data_block()
+{
+	fetch();  // compatibility command (0x66)
+	const u8 type  = fetch();
+	const u32 size = fetch_le(4);
+	const u8 index = bitfield(size, 31);
+	u32 len		   = bitfield(size, 0, 31);
+	if ((type < 0x80) || (type > 0xbf) || (len < 8))
+	{
+		skip(len);
+		return;
+	}
+
+	// ROM data
+	const u32 rom_size = fetch_le(4);
+	u32 start		   = fetch_le(4);
+	len				   -= 8;
+	switch (type)
+	{
+		case 0x8b: rom_block(CHIP_MSM6295, index, 0, rom_size, start, len); break;
+		case 0x8e: rom_block(CHIP_K053260, index, 0, rom_size, start, len); break;
+		case 0x90:	// bank in bit 28-31 of start address
+		{
+			const u8 bank = bitfield(start, 28, 4);
+			rom_block(CHIP_ES550X, index, bank, rom_size, bitfield(start, 0, 28), len);
+			break;
+		}
+		case 0x91: rom_block(CHIP_X1_010, index, 0, rom_size, start, len); break;
+		default: skip(len); break;
+	}
+}
+
+void vgm_player_core::rom_block(u8 chip, u8 index, u8 region, u32 rom_size, u32 start, u32 size)
+{
+	board_device *dev = m_device[chip][index].get();
+	if (dev == nullptr)
+	{
+		skip(size);
+		return;
+	}
+
+	// reject broken or too large block
+	if ((rom_size > 0x10000000) || ((u64(start) + size) > 0x10000000))
+	{
+		skip(size);
+		return;
+	}
+
+	std::vector<u8> &rom = m_rom[(u32(chip) << 16) | (u32(index) << 8) | region];
+	rom.resize(std::max<u64>(rom_size, u64(start) + size), 0);
+	read(rom.data() + start, size);
+	dev->set_rom(region, rom.data(), u32(rom.size()));
+}
+
+void vgm_player_core::msm6295_w(u8 index, u8 address, u8 data)
+{
+	board_msm6295_device *dev =
+	  static_cast<board_msm6295_device *>(m_device[CHIP_MSM6295][index].get());
+	if (dev == nullptr)
+	{
+		return;
+	}
+
+	switch (address)
+	{
+		case 0x00: dev->write(0, data); break;
+		case 0x08:
+		case 0x09:
+		case 0x0a:
+		case 0x0b:
+		{
+			const u8 shift		   = (address - 0x08) << 3;
+			m_msm6295_clock[index] &= ~(0xff << shift);
+			m_msm6295_clock[index] |= u32(data) << shift;
+			dev->set_clock(m_msm6295_clock[index]);
+			break;
+		}
+		case 0x0c: dev->set_ss(data != 0); break;
+		case 0x0e: dev->set_nmk112(data); break;
+		case 0x0f:
+		case 0x10:
+		case 0x11:
+		case 0x12: dev->set_nmk112_bank(address - 0x0f, data); break;
+		default: break;
+	}
+}
+
+void vgm_player_core::scc_w(u8 index, u8 port, u8 address, u8 data)
+{
+	board_scc_device *dev = static_cast<board_scc_device *>(m_device[CHIP_SCC][index].get());
+	if (dev == nullptr)
+	{
+		return;
+	}
+
+	// register base of SCC and SCC+ layout
+	const bool sccplus = dev->sccplus();
+	switch (port)
+	{
+		case 0x00:	// waveform
+			dev->write(bitfield(address, 0, 7), data);
+			break;
+		case 0x01:	// frequency
+			dev->write((sccplus ? 0xa0 : 0x80) + (address % 10), data);
+			break;
+		case 0x02:	// volume
+			dev->write((sccplus ? 0xaa : 0x8a) + (address % 5), data);
+			break;
+		case 0x03:	// key on/off
+			dev->write(sccplus ? 0xaf : 0x8f, data);
+			break;
+		case 0x04:	// waveform (SCC+)
+			if (sccplus || (address < 0x80))
+			{
+				dev->write(address, data);
+			}
+			break;
+		case 0x05:	// test register
+			dev->write(sccplus ? 0xc0 : 0xe0, data);
+			break;
+		default: break;
+	}
+}
+
+// stream buffer
+bool vgm_player_core::fill()
+{
+	m_buf_base += m_buf_len;
+	m_buf_pos = 0;
+	m_buf_len = (m_reader != nullptr) ? m_reader->read(m_buf.data(), u32(m_buf.size())) : 0;
+	return m_buf_len > 0;
+}
+
+void vgm_player_core::seek(u32 offset)
+{
+	if ((offset >= m_buf_base) && (offset < (m_buf_base + m_buf_len)))
+	{
+		m_buf_pos = offset - m_buf_base;
+		return;
+	}
+
+	if (m_reader != nullptr)
+	{
+		m_reader->seek(offset);
+	}
+	m_buf_base = offset;
+	m_buf_pos  = 0;
+	m_buf_len  = 0;
+}
+
+void vgm_player_core::skip(u32 size) { seek(tell() + size); }
+
+void vgm_player_core::read(u8 *data, u32 size)
+{
+	// from buffer
+	const u32 buffered = std::min<u32>(size, m_buf_len - m_buf_pos);
+	std::copy_n(m_buf.data() + m_buf_pos, buffered, data);
+	m_buf_pos += buffered;
+	size	  -= buffered;
+	if (size == 0)
+	{
+		return;
+	}
+
+	// directly from stream
+	m_buf_base += m_buf_len;
+	m_buf_pos = 0;
+	m_buf_len = 0;
+	if (m_reader != nullptr)
+	{
+		const u32 len = m_reader->read(data + buffered, size);
+		std::fill_n(data + buffered + len, size - len, 0);
+		m_buf_base += len;
+	}
+}
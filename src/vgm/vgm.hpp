@@ -0,0 +1,227 @@
+/*
+	License: Zlib
+	see https://gitlab.com/cam900/vgsound_emu/-/blob/main/LICENSE for more details
+
+	Copyright holder(s): cam900
+	Streaming VGM log player
+
+	See vgm.cpp for more info.
+*/
+
+#ifndef _VGSOUND_EMU_SRC_VGM_VGM_HPP
+#define _VGSOUND_EMU_SRC_VGM_VGM_HPP
+
+#pragma once
+
+#include "../board/board.hpp"
+#include "../board/board_devices.hpp"
+#include "../core/util.hpp"
+
+#include <cstdio>
+#include <map>
+
+// VGM byte stream source
+class vgm_reader_intf
+{
+	public:
+		virtual ~vgm_reader_intf() {}
+
+		// read up to size bytes into data, returns read bytes
+		virtual u32 read(u8 *data, u32 size) = 0;
+
+		// seek to absolute offset
+		virtual bool seek(u32 offset) = 0;
+};
+
+// VGM file, streamed without loading whole file
+class vgm_file_reader : public vgm_reader_intf
+{
+	public:
+		vgm_file_reader()
+			: m_file(nullptr)
+		{
+		}
+
+		virtual ~vgm_file_reader() { close(); }
+
+		bool open(const std::string &path);
+		void close();
+
+		virtual u32 read(u8 *data, u32 size) override;
+		virtual bool seek(u32 offset) override;
+
+	private:
+		std::FILE *m_file = nullptr;
+};
+
+// VGM in memory, or memory mapped file
+class vgm_memory_reader : public vgm_reader_intf
+{
+	public:
+		vgm_memory_reader(const u8 *data = nullptr, u32 size = 0)
+			: m_data(data)
+			, m_size(size)
+			, m_pos(0)
+		{
+		}
+
+		inline void set(const u8 *data, u32 size)
+		{
+			m_data = data;
+			m_size = size;
+			m_pos  = 0;
+		}
+
+		virtual u32 read(u8 *data, u32 size) override;
+		virtual bool seek(u32 offset) override;
+
+	private:
+		const u8 *m_data = nullptr;	 // VGM data
+		u32 m_size		 = 0;		 // VGM size
+		u32 m_pos		 = 0;		 // read position
+};
+
+class vgm_player_core : public vgsound_emu_core
+{
+	public:
+		// supported chips
+		enum chip_t : u8
+		{
+			CHIP_SCC = 0,  // K051649/K052539
+			CHIP_K053260,
+			CHIP_MSM6295,
+			CHIP_X1_010,
+			CHIP_ES550X,  // ES5505/ES5506
+			CHIP_COUNT
+		};
+
+		// constructor
+		vgm_player_core(u32 rate = 44100)
+			: vgsound_emu_core("vgm_player")
+			, m_reader(nullptr)
+			, m_board(rate)
+			, m_device()
+			, m_rom()
+			, m_buf(0x10000)
+			, m_buf_base(0)
+			, m_buf_pos(0)
+			, m_buf_len(0)
+			, m_version(0)
+			, m_data_offset(0)
+			, m_eof_offset(0)
+			, m_loop_offset(0)
+			, m_total_samples(0)
+			, m_loop_samples(0)
+			, m_es5506(false)
+			, m_msm6295_init(0)
+			, m_msm6295_clock{0}
+			, m_loops(0)
+			, m_loop_count(0)
+			, m_ended(true)
+			, m_time(0)
+			, m_out_time(0)
+		{
+		}
+
+		// open stream and attach chips from header, reader must be alive while playing
+		bool open(vgm_reader_intf &reader);
+		void close();
+
+		// restart from beginning
+		void reset();
+
+		// render interleaved stereo output, returns rendered samples
+		// rest of buffer is cleared if stream is ended
+		u32 render(s32 *out, u32 samples);
+
+		// setters
+		inline void set_loops(u32 loops) { m_loops = loops; }  // loop count, ~0 for infinite
+
+		// getters
+		inline bool ended() { return m_ended; }
+
+		inline u32 version() { return m_version; }
+
+		inline u32 total_samples() { return m_total_samples; }	// at 44100 Hz
+
+		inline u32 loop_samples() { return m_loop_samples; }  // at 44100 Hz
+
+		inline u32 rate() { return m_board.rate(); }
+
+		inline board_core &board() { return m_board; }
+
+		inline board_device *device(u8 chip, u8 index)
+		{
+			return (chip < CHIP_COUNT) ? m_device[chip][index & 1].get() : nullptr;
+		}
+
+	private:
+		// command stream
+		bool execute();
+		void end_of_data();
+		void data_block();
+		void rom_block(u8 chip, u8 index, u8 region, u32 rom_size, u32 start, u32 size);
+
+		// chip writes
+		void msm6295_w(u8 index, u8 address, u8 data);
+		void scc_w(u8 index, u8 port, u8 address, u8 data);
+
+		// stream buffer
+		bool fill();
+		void seek(u32 offset);
+		void skip(u32 size);
+		void read(u8 *data, u32 size);
+
+		inline u32 tell() { return m_buf_base + m_buf_pos; }
+
+		inline u8 fetch()
+		{
+			if ((m_buf_pos >= m_buf_len) && (!fill()))
+			{
+				return 0x66;  // end of data
+			}
+			return m_buf[m_buf_pos++];
+		}
+
+		inline u32 fetch_le(u8 bytes)
+		{
+			u32 ret = 0;
+			for (u8 b = 0; b < bytes; b++)
+			{
+				ret |= u32(fetch()) << (b << 3);
+			}
+			return ret;
+		}
+
+		vgm_reader_intf *m_reader = nullptr;  // stream source
+		board_core m_board;					  // attached chips
+
+		std::array<std::array<std::unique_ptr<board_device>, 2>, CHIP_COUNT> m_device;
+		std::map<u32, std::vector<u8>> m_rom;  // ROM data blocks for each chip and region
+
+		std::vector<u8> m_buf;	// stream buffer
+		u32 m_buf_base = 0;		// stream offset of buffer
+		u32 m_buf_pos  = 0;		// read position in buffer
+		u32 m_buf_len  = 0;		// valid bytes in buffer
+
+		// header
+		u32 m_version		= 0;	  // VGM version
+		u32 m_data_offset	= 0;	  // start of command stream
+		u32 m_eof_offset	= 0;	  // end of file
+		u32 m_loop_offset	= 0;	  // loop point, 0 if not looped
+		u32 m_total_samples = 0;	  // total length
+		u32 m_loop_samples	= 0;	  // loop length
+		bool m_es5506		= false;  // ES5506 or ES5505
+		u32 m_msm6295_init	= 0;	  // MSM6295 clock and SS pin from header
+
+		std::array<u32, 2> m_msm6295_clock = {0};  // MSM6295 clock, changeable by command
+
+		// playback state
+		u32 m_loops		 = 0;	  // loop count
+		u32 m_loop_count = 0;	  // current loop
+		bool m_ended	 = true;  // end of stream
+		u64 m_time		 = 0;	  // stream time, 44100 Hz
+		u64 m_out_time	 = 0;	  // rendered samples, host rate
+};
+
+#endif
@@ -89,15 +89,28 @@
 
 void vrcvi_core::tick()
 {
+	m_stats.tick.inc();
 	m_out = 0;
 	if (!m_control.halt())	// Halt flag
 	{
 		// tick per each clock
-		for (auto &elem : m_pulse)
+		for (u8 v = 0; v < 2; v++)
 		{
-			m_out += elem.get_output();	 // add 4 bit pulse output
+			const u8 cycle = m_pulse[v].cycle();
+			m_out		   += m_pulse[v].get_output();	// add 4 bit pulse output
+			count_voice(v, m_pulse[v], cycle);
 		}
-		m_out += m_sawtooth.get_output();  // add 5 bit sawtooth output
+		const u8 cycle = m_sawtooth.cycle();
+		m_out		   += m_sawtooth.get_output();	// add 5 bit sawtooth output
+		count_voice(2, m_sawtooth, cycle);
+	}
+	else
+	{
+		for (u8 v = 0; v < 2; v++)
+		{
+			count_voice(v, m_pulse[v], m_pulse[v].cycle());
+		}
+		count_voice(2, m_sawtooth, m_sawtooth.cycle());
 	}
 	if (m_timer.tick())
 	{
@@ -105,6 +118,81 @@ void vrcvi_core::tick()
 	}
 }
 
+// run clocks, returns sum of outputs
+// channel outputs are constant between carries, so it ticks only at events and skips others
+s32 vrcvi_core::run(u32 clocks)
+{
+	s32 acc = 0;
+	while (clocks > 0)
+	{
+		// clocks until next event, 0 means no event
+		u32 step = clocks;
+		if (!m_control.halt())	// Halt flag, channels are not clocked
+		{
+			for (auto &elem : m_pulse)
+			{
+				const u32 delay = elem.carry_delay();
+				if (delay)
+				{
+					step = std::min(step, delay);
+				}
+			}
+			const u32 saw_delay = m_sawtooth.carry_delay();
+			if (saw_delay)
+			{
+				step = std::min(step, saw_delay);
+			}
+		}
+		const u32 irq_delay = m_timer.irq_delay();
+		if (irq_delay)
+		{
+			step = std::min(step, irq_delay);
+		}
+
+		// skip constant output segment
+		if (step > 1)
+		{
+			const u32 skip = step - 1;
+			m_stats.tick.inc(skip);
+			for (u8 v = 0; v < 2; v++)
+			{
+				count_voice(v, m_pulse[v], m_pulse[v].cycle(), skip);
+			}
+			count_voice(2, m_sawtooth, m_sawtooth.cycle(), skip);
+			if (!m_control.halt())	// Halt flag
+			{
+				acc += (m_pulse[0].level() + m_pulse[1].level() + m_sawtooth.level()) * skip;
+				for (auto &elem : m_pulse)
+				{
+					elem.skip(skip);
+				}
+				m_sawtooth.skip(skip);
+			}
+			m_timer.skip(skip);
+			clocks -= skip;
+		}
+
+		// event
+		tick();
+		acc += m_out;
+		clocks--;
+	}
+	return acc;
+}
+
+void vrcvi_core::advance(u32 clocks) { run(clocks); }
+
+void vrcvi_core::render(s32 *out, u32 samples, u32 clock, u32 rate)
+{
+	for (u32 s = 0; s < samples; s++)
+	{
+		m_render_frac += clock;
+		const u32 clocks = m_render_frac / rate;
+		m_render_frac %= rate;
+		out[s] = clocks ? ((run(clocks) << 8) / s32(clocks)) : (m_out << 8);
+	}
+}
+
 void vrcvi_core::reset()
 {
 	for (auto &elem : m_pulse)
@@ -115,7 +203,8 @@ void vrcvi_core::reset()
 	m_sawtooth.reset();
 	m_timer.reset();
 	m_control.reset();
-	m_out = 0;
+	m_out		  = 0;
+	m_render_frac = 0;
 }
 
 bool vrcvi_core::alu_t::tick()
@@ -154,6 +243,47 @@ bool vrcvi_core::alu_t::tick()
 	return false;
 }
 
+// clocks until next carry includes carry itself, 0 if disabled
+u32 vrcvi_core::alu_t::carry_delay()
+{
+	if (!m_divider.enable())
+	{
+		return 0;
+	}
+
+	if (bitfield(m_host.m_control.shift(), 1))
+	{
+		return bitfield(m_counter, 8, 4) + 1;
+	}
+	else if (bitfield(m_host.m_control.shift(), 0))
+	{
+		return bitfield(m_counter, 4, 8) + 1;
+	}
+	return bitfield(m_counter, 0, 12) + 1;
+}
+
+// skip clocks without carry, clocks must be less than carry_delay()
+void vrcvi_core::alu_t::skip(u32 clocks)
+{
+	if (m_divider.enable())
+	{
+		if (bitfield(m_host.m_control.shift(), 1))
+		{
+			m_counter = (bitfield<u32>(bitfield(m_counter, 8, 4) - clocks, 0, 4) << 8) |
+						(bitfield<u32>(bitfield(m_counter, 0, 8) - clocks, 0, 8) << 0);
+		}
+		else if (bitfield(m_host.m_control.shift(), 0))
+		{
+			m_counter = (bitfield<u32>(bitfield(m_counter, 4, 8) - clocks, 0, 8) << 4) |
+						(bitfield<u32>(bitfield(m_counter, 0, 4) - clocks, 0, 4) << 0);
+		}
+		else
+		{
+			m_counter = bitfield<u32>(bitfield(m_counter, 0, 12) - clocks, 0, 12);
+		}
+	}
+}
+
 bool vrcvi_core::pulse_t::tick()
 {
 	if (!m_divider.enable())
@@ -205,6 +335,26 @@ s8 vrcvi_core::sawtooth_t::get_output()
 	return m_out;
 }
 
+s8 vrcvi_core::pulse_t::level()
+{
+	if (!m_divider.enable())
+	{
+		return 0;
+	}
+
+	return (m_control.mode() || (m_cycle > m_control.duty())) ? m_control.volume() : 0;
+}
+
+s8 vrcvi_core::sawtooth_t::level()
+{
+	if (!m_divider.enable())
+	{
+		return 0;
+	}
+
+	return (m_accum == 0) ? 0 : bitfield(m_accum, 3, 5);
+}
+
 void vrcvi_core::alu_t::reset()
 {
 	m_divider.reset();
@@ -252,6 +402,50 @@ void vrcvi_core::timer_t::counter_tick()
 	}
 }
 
+// clocks until next IRQ includes IRQ clock itself, 0 if disabled
+u32 vrcvi_core::timer_t::irq_delay()
+{
+	if (!m_timer_control.enable())
+	{
+		return 0;
+	}
+
+	const u32 ticks = 256 - m_counter;
+	if (m_timer_control.sync())
+	{
+		return ticks;
+	}
+
+	// scanline sync mode, n-th counter tick is at ceil((prescaler + 341 * (n - 1)) / 3)
+	return (m_prescaler + (341 * (ticks - 1)) + 2) / 3;
+}
+
+// skip clocks without IRQ, clocks must be less than irq_delay()
+void vrcvi_core::timer_t::skip(u32 clocks)
+{
+	if (m_timer_control.enable())
+	{
+		if (m_timer_control.sync())
+		{
+			m_counter += clocks;
+		}
+		else  // scanline sync mode
+		{
+			const s32 dec = 3 * clocks;
+			if (dec >= m_prescaler)
+			{
+				const s32 ticks = ((dec - m_prescaler) / 341) + 1;
+				m_prescaler		= m_prescaler - dec + (341 * ticks);
+				m_counter		+= ticks;
+			}
+			else
+			{
+				m_prescaler -= dec;
+			}
+		}
+	}
+}
+
 void vrcvi_core::timer_t::reset()
 {
 	m_timer_control.reset();
@@ -277,6 +471,7 @@ void vrcvi_core::alu_t::divider_t::write(bool msb, u8 data)
 
 void vrcvi_core::pulse_w(u8 voice, u8 address, u8 data)
 {
+	m_stats.access.inc();
 	pulse_t &v = m_pulse[voice];
 	switch (address)
 	{
@@ -298,6 +493,7 @@ void vrcvi_core::pulse_w(u8 voice, u8 address, u8 data)
 
 void vrcvi_core::saw_w(u8 address, u8 data)
 {
+	m_stats.access.inc();
 	switch (address)
 	{
 		case 0x00:	// Sawtooth Accumulate - 0xb000
@@ -318,6 +514,7 @@ void vrcvi_core::saw_w(u8 address, u8 data)
 
 void vrcvi_core::timer_w(u8 address, u8 data)
 {
+	m_stats.access.inc();
 	switch (address)
 	{
 		case 0x00:	// Timer latch - 0xf000
@@ -334,6 +531,7 @@ void vrcvi_core::timer_w(u8 address, u8 data)
 
 void vrcvi_core::control_w(u8 data)
 {
+	m_stats.access.inc();
 	// Global control - 0x9003
 	m_control.write(data);
 }
@@ -18,6 +18,11 @@
 class vrcvi_intf : public vgsound_emu_core
 {
 	public:
+		vrcvi_intf()
+			: vgsound_emu_core("vrcvi_intf")
+		{
+		}
+
 		virtual void irq_w(bool irq) {}
 };
 
@@ -78,6 +83,13 @@ class vrcvi_core : public vgsound_emu_core
 					return 0;
 				}
 
+				// output level of current state, without clocking
+				virtual s8 level() { return 0; }
+
+				// event skipping
+				u32 carry_delay();
+				void skip(u32 clocks);
+
 				// accessors
 				inline void clear_cycle() { m_cycle = 0; }
 
@@ -152,6 +164,7 @@ class vrcvi_core : public vgsound_emu_core
 				virtual void reset() override;
 				virtual bool tick() override;
 				virtual s8 get_output() override;
+				virtual s8 level() override;
 
 				// getters
 				pulse_control_t &control() { return m_control; }
@@ -174,6 +187,7 @@ class vrcvi_core : public vgsound_emu_core
 				virtual void reset() override;
 				virtual bool tick() override;
 				virtual s8 get_output() override;
+				virtual s8 level() override;
 
 				// accessors
 				inline void clear_accum() { m_accum = 0; }
@@ -260,6 +274,10 @@ class vrcvi_core : public vgsound_emu_core
 				bool tick();
 				void counter_tick();
 
+				// event skipping
+				u32 irq_delay();
+				void skip(u32 clocks);
+
 				// IRQ update
 				void update() { m_host.m_intf.irq_w(m_timer_control.irq_trigger()); }
 
@@ -369,6 +387,8 @@ class vrcvi_core : public vgsound_emu_core
 			, m_timer(*this)
 			, m_control(global_control_t())
 			, m_out(0)
+			, m_render_frac(0)
+			, m_stats()
 		{
 		}
 
@@ -382,15 +402,54 @@ class vrcvi_core : public vgsound_emu_core
 		void reset();
 		void tick();
 
+		// render output into buffer at host rate, each sample is averaged output of clock / rate
+		// ticks in 6 bit integer and 8 bit fraction
+		void render(s32 *out, u32 samples, u32 clock, u32 rate);
+
+		// timer IRQ prediction for host scheduler
+		// clocks until next IRQ includes IRQ clock itself, 0 if timer is disabled
+		inline u32 irq_delay() { return m_timer.irq_delay(); }
+
+		// advance clocks without output, IRQ is triggered at exact clock
+		void advance(u32 clocks);
+
 		// 6 bit output
 		inline s8 out() { return m_out; }
 
+		// IRQ output
+		inline bool irq() { return m_timer.timer_control().irq_trigger(); }
+
 		// for debug/preview only
 		inline s8 pulse_out(u8 pulse) { return (pulse < 2) ? m_pulse[pulse].out() : 0; }
 
 		inline s8 sawtooth_out() { return m_sawtooth.out(); }
 
+		// instrumentation, counted only if VGSOUND_EMU_ENABLE_STATS is defined
+		// voice 0 and 1 are pulse channels, voice 2 is sawtooth channel
+		typedef core_stats_t<3> stats_t;
+
+		inline const stats_t &stats() { return m_stats; }
+
+		inline void reset_stats() { m_stats.reset(); }
+
 	private:
+		s32 run(u32 clocks);
+
+		// count channel updates, cycle is cycle before update
+		inline void count_voice(u8 voice, alu_t &alu, u8 cycle, u32 clocks = 1)
+		{
+			voice_stats_t &stats = m_stats.voice[voice];
+			stats.tick.inc(clocks);
+			if (m_control.halt() || (!alu.divider().enable()))
+			{
+				stats.idle.inc(clocks);
+			}
+			if (alu.cycle() < cycle)
+			{  // waveform loop
+				stats.loop.inc();
+			}
+		}
+
 		vrcvi_intf &m_intf;
 
 		std::array<pulse_t, 2> m_pulse;	 // 2 pulse channels
@@ -399,6 +458,10 @@ class vrcvi_core : public vgsound_emu_core
 		global_control_t m_control;		 // control
 
 		s8 m_out = 0;  // 6 bit output
+
+		u32 m_render_frac = 0;	// fraction of clock / rate for render
+
+		stats_t m_stats;  // instrumentation counters
 };
 
 #endif
@@ -89,31 +89,42 @@
 
 void x1_010_core::tick()
 {
+	m_stats.tick.inc();
 	// reset output
 	m_out[0] = m_out[1] = 0;
-	for (voice_t &elem : m_voice)
+	for (u8 v = 0; v < 16; v++)
 	{
-		elem.tick();
-		m_out[0] += elem.out(0);
-		m_out[1] += elem.out(1);
+		m_voice[v].tick(v);
+		m_out[0] += m_voice[v].out(0);
+		m_out[1] += m_voice[v].out(1);
+	}
+
+	if (m_scope.enabled() && m_scope.capture())
+	{
+		for (u8 v = 0; v < 16; v++)
+		{
+			m_scope.set(v, m_voice[v].out(0) + m_voice[v].out(1));
+		}
+		m_scope.next();
 	}
 }
 
-void x1_010_core::voice_t::tick()
+void x1_010_core::voice_t::tick(u8 voice)
 {
+	m_host.m_stats.voice[voice].tick.inc();
 	m_out[0] = m_out[1] = 0;
 	if (m_flag.keyon())
 	{
 		if (m_flag.wavetable())	 // Wavetable
 		{
 			// envelope, each nibble is for each output
-			u8 vol =
-			  m_host.m_envelope[(bitfield(m_end_envshape, 0, 5) << 7) | bitfield(m_env_acc, 10, 7)];
+			u8 vol		 = m_env_table[bitfield(m_env_acc, 10, 7)];
 			m_vol_out[0] = bitfield(vol, 4, 4);
 			m_vol_out[1] = bitfield(vol, 0, 4);
 			m_env_acc	 += m_start_envfreq;
 			if (m_flag.env_oneshot() && bitfield(m_env_acc, 17))
 			{
+				m_host.m_stats.voice[voice].loop.inc();
 				m_flag.set_keyon(false);
 			}
 			else
@@ -121,8 +132,8 @@ void x1_010_core::voice_t::tick()
 				m_env_acc = bitfield(m_env_acc, 0, 17);
 			}
 			// get wavetable data
-			m_data = m_host.m_wave[(bitfield(m_vol_wave, 0, 5) << 7) | bitfield(m_acc, 11, 7)];
-			m_acc  = bitfield(m_acc + (m_freq << (1 - m_flag.div())), 0, 18);
+			m_data = m_wave_table[bitfield(m_acc, 11, 7)];
+			m_acc  = bitfield(m_acc + m_step, 0, 18);
 		}
 		else  // PCM sample
 		{
@@ -130,20 +141,236 @@ void x1_010_core::voice_t::tick()
 			m_vol_out[0] = bitfield(m_vol_wave, 4, 4);
 			m_vol_out[1] = bitfield(m_vol_wave, 0, 4);
 			// get PCM sample
-			m_data = m_host.m_intf.read_byte(bitfield(m_acc, 5, 20));
-			m_acc  += u32(bitfield(m_freq, 0, 8)) << (1 - m_flag.div());
+			m_data = m_host.read_byte(voice, bitfield(m_acc, 5, 20));
+			m_acc  += m_step;
 			if ((m_acc >> 17) > (0xff ^ m_end_envshape))
 			{
+				m_host.m_stats.voice[voice].loop.inc();
 				m_flag.set_keyon(false);
 			}
 		}
 		m_out[0] = m_data * m_vol_out[0];
 		m_out[1] = m_data * m_vol_out[1];
 	}
+	else
+	{
+		m_host.m_stats.voice[voice].idle.inc();
+	}
+}
+
+// key off voice is changed only by register writes
+bool x1_010_core::idle()
+{
+	if (m_scope.enabled())
+	{
+		return false;
+	}
+
+	for (voice_t &elem : m_voice)
+	{
+		if (elem.keyon())
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+void x1_010_core::skip_idle(u64 ticks)
+{
+	if (ticks == 0)
+	{
+		return;
+	}
+
+	m_stats.tick.inc(ticks);
+	m_out[0] = m_out[1] = 0;
+	for (voice_t &elem : m_voice)
+	{
+		elem.skip_idle();
+	}
+}
+
+// render stereo output, each voice is processed in block for keep states in registers
+void x1_010_core::render(s32 *left, s32 *right, u32 samples)
+{
+	if (samples == 0)
+	{
+		return;
+	}
+
+	m_stats.tick.inc(samples);
+	std::fill(left, left + samples, 0);
+	std::fill(right, right + samples, 0);
+	if (m_scope.enabled())
+	{
+		render_scope(left, right, samples);
+		return;
+	}
+
+	m_out[0] = m_out[1] = 0;
+	for (u8 v = 0; v < 16; v++)
+	{
+		m_voice[v].render(v, left, right, samples);
+		m_out[0] += m_voice[v].out(0);
+		m_out[1] += m_voice[v].out(1);
+	}
+}
+
+// same as above, but each voice is rendered separately for capture
+void x1_010_core::render_scope(s32 *left, s32 *right, u32 samples)
+{
+	m_scope_buf[0].resize(samples);
+	m_scope_buf[1].resize(samples);
+	s32 *vl = m_scope_buf[0].data();
+	s32 *vr = m_scope_buf[1].data();
+
+	m_out[0] = m_out[1] = 0;
+	for (u8 v = 0; v < 16; v++)
+	{
+		std::fill(vl, vl + samples, 0);
+		std::fill(vr, vr + samples, 0);
+		m_voice[v].render(v, vl, vr, samples);
+		for (u32 s = 0; s < samples; s++)
+		{
+			left[s] += vl[s];
+			right[s] += vr[s];
+			vl[s] += vr[s];
+		}
+		m_scope.set_block(v, vl, samples);
+		m_out[0] += m_voice[v].out(0);
+		m_out[1] += m_voice[v].out(1);
+	}
+	m_scope.next_block(samples);
+}
+
+// same as tick but for whole block, output is accumulated into buffers
+void x1_010_core::voice_t::render(u8 voice, s32 *left, s32 *right, u32 samples)
+{
+	voice_stats_t &stats = m_host.m_stats.voice[voice];
+	stats.tick.inc(samples);
+	m_out[0] = m_out[1] = 0;
+	if (!m_flag.keyon())
+	{
+		stats.idle.inc(samples);
+		return;
+	}
+
+	u32 run		= samples;
+	bool keyoff = false;
+	if (m_flag.wavetable())	 // Wavetable
+	{
+		const u32 env_step = m_start_envfreq;
+		// envelope accumulator isn't wrapped in one-shot mode, key off when carry is occured
+		const u32 env_mask = m_flag.env_oneshot() ? ~0 : 0x1ffff;
+		if (m_flag.env_oneshot() && (env_step != 0))
+		{
+			const u32 remain = (m_env_acc < 0x20000) ? (0x20000 - m_env_acc) : 0;
+			const u32 end	 = std::max<u32>(1, (remain + env_step - 1) / env_step);
+			if (end <= samples)
+			{
+				run	   = end;
+				keyoff = true;
+			}
+		}
+
+		const u8 *env  = m_env_table;
+		const u8 *wave = m_wave_table;
+		const u32 step = m_step;
+		u32 acc		   = m_acc;
+		u32 env_acc	   = m_env_acc;
+		for (u32 i = 0; i < run; i++)
+		{
+			const u8 vol   = env[bitfield(env_acc, 10, 7)];
+			const s32 data = s8(wave[bitfield(acc, 11, 7)]);
+			left[i]		   += data * bitfield(vol, 4, 4);
+			right[i]	   += data * bitfield(vol, 0, 4);
+			env_acc		   = (env_acc + env_step) & env_mask;
+			acc			   = bitfield(acc + step, 0, 18);
+		}
+
+		// restore internal state of last tick
+		const u8 vol = env[bitfield((env_acc - env_step) & env_mask, 10, 7)];
+		m_vol_out[0] = bitfield(vol, 4, 4);
+		m_vol_out[1] = bitfield(vol, 0, 4);
+		m_data		 = wave[bitfield(acc - step, 11, 7)];
+		m_acc		 = acc;
+		m_env_acc	 = env_acc;
+	}
+	else  // PCM sample
+	{
+		// key off when address is reached to end
+		const u32 limit = u32((0xff ^ m_end_envshape) + 1) << 17;
+		if (m_acc >= limit)
+		{
+			run	   = 1;
+			keyoff = true;
+		}
+		else if (m_step != 0)
+		{
+			const u32 end = (limit - m_acc + m_step - 1) / m_step;
+			if (end <= samples)
+			{
+				run	   = end;
+				keyoff = true;
+			}
+		}
+
+		m_vol_out[0]   = bitfield(m_vol_wave, 4, 4);
+		m_vol_out[1]   = bitfield(m_vol_wave, 0, 4);
+		const s32 lvol = m_vol_out[0];
+		const s32 rvol = m_vol_out[1];
+		if (m_host.m_rom.valid())
+		{
+			stats.direct.inc(run);
+			// direct ROM access, prefetch next cache line ahead of accumulator
+			const rom_span_t &rom = m_host.m_rom;
+			u32 line			  = ~0;
+			for (u32 i = 0; i < run; i++)
+			{
+				const u32 addr = bitfield(m_acc, 5, 20);
+				if ((addr >> 6) != line)
+				{
+					line = addr >> 6;
+					rom.prefetch(addr + 64);
+				}
+				m_data	 = rom.read_byte(addr);
+				left[i]	 += m_data * lvol;
+				right[i] += m_data * rvol;
+				m_acc	 += m_step;
+			}
+		}
+		else
+		{
+			stats.read.inc(run);
+			for (u32 i = 0; i < run; i++)
+			{
+				m_data	 = m_host.m_intf.read_byte(bitfield(m_acc, 5, 20));
+				left[i]	 += m_data * lvol;
+				right[i] += m_data * rvol;
+				m_acc	 += m_step;
+			}
+		}
+	}
+
+	if (keyoff)
+	{
+		stats.loop.inc();
+		stats.idle.inc(samples - run);
+		m_flag.set_keyon(false);
+	}
+
+	// last output, voice is silent after key off
+	if (run == samples)
+	{
+		m_out[0] = m_data * m_vol_out[0];
+		m_out[1] = m_data * m_vol_out[1];
+	}
 }
 
 u8 x1_010_core::ram_r(u16 offset)
 {
+	m_stats.access.inc();
 	if (offset & 0x1000)
 	{  // wavetable data
 		return m_wave[offset & 0xfff];
@@ -160,6 +387,7 @@ u8 x1_010_core::ram_r(u16 offset)
 
 void x1_010_core::ram_w(u16 offset, u8 data)
 {
+	m_stats.access.inc();
 	if (offset & 0x1000)
 	{  // wavetable data
 		m_wave[offset & 0xfff] = data;
@@ -204,17 +432,43 @@ void x1_010_core::voice_t::reg_w(u8 offset, u8 data)
 					m_acc	  = m_flag.wavetable() ? 0 : (u32(m_start_envfreq) << 17);
 					m_env_acc = 0;
 				}
+				update_step();
 				break;
 			}
-		case 0x01: m_vol_wave = data; break;
-		case 0x02: m_freq = (m_freq & 0xff00) | data; break;
-		case 0x03: m_freq = (m_freq & 0x00ff) | (u16(data) << 8); break;
+		case 0x01:
+			m_vol_wave = data;
+			update_table();
+			break;
+		case 0x02:
+			m_freq = (m_freq & 0xff00) | data;
+			update_step();
+			break;
+		case 0x03:
+			m_freq = (m_freq & 0x00ff) | (u16(data) << 8);
+			update_step();
+			break;
 		case 0x04: m_start_envfreq = data; break;
-		case 0x05: m_end_envshape = data; break;
+		case 0x05:
+			m_end_envshape = data;
+			update_table();
+			break;
 		default: break;
 	}
 }
 
+void x1_010_core::voice_t::update_table()
+{
+	m_env_table	 = &m_host.m_envelope[bitfield(m_end_envshape, 0, 5) << 7];
+	m_wave_table = &m_host.m_wave[bitfield(m_vol_wave, 0, 5) << 7];
+}
+
+void x1_010_core::voice_t::update_step()
+{
+	// PCM uses lower 8 bit of frequency only
+	const u32 freq = m_flag.wavetable() ? m_freq : bitfield(m_freq, 0, 8);
+	m_step		   = freq << (1 - m_flag.div());
+}
+
 void x1_010_core::voice_t::reset()
 {
 	m_flag.reset();
@@ -227,6 +481,8 @@ void x1_010_core::voice_t::reset()
 	m_data			= 0;
 	m_vol_out.fill(0);
 	m_out.fill(0);
+	m_step = 0;
+	update_table();
 }
 
 void x1_010_core::reset()
@@ -239,4 +495,36 @@ void x1_010_core::reset()
 	m_envelope.fill(0);
 	m_wave.fill(0);
 	m_out.fill(0);
+	m_scope.reset();
+}
+
+void x1_010_core::serialize(serializer_t &s)
+{
+	s.item(m_envelope);
+	s.item(m_wave);
+	s.item(m_out);
+	for (auto &elem : m_voice)
+	{
+		elem.serialize(s);
+	}
+}
+
+void x1_010_core::voice_t::serialize(serializer_t &s)
+{
+	m_flag.serialize(s);
+	s.item(m_vol_wave);
+	s.item(m_freq);
+	s.item(m_start_envfreq);
+	s.item(m_end_envshape);
+	s.item(m_acc);
+	s.item(m_env_acc);
+	s.item(m_data);
+	s.item(m_vol_out);
+	s.item(m_out);
+	if (s.loading())
+	{
+		// recalculate cached values from loaded registers
+		update_table();
+		update_step();
+	}
 }
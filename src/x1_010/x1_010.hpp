@@ -45,6 +45,14 @@ class x1_010_core : public vgsound_emu_core
 							m_keyon		  = 0;
 						}
 
+						void serialize(serializer_t &s)
+						{
+							m_div		  = s.value<u8>(m_div);
+							m_env_oneshot = s.value<u8>(m_env_oneshot);
+							m_wavetable	  = s.value<u8>(m_wavetable);
+							m_keyon		  = s.value<u8>(m_keyon);
+						}
+
 						// register accessor
 						inline void write(u8 data)
 						{
@@ -88,20 +96,34 @@ class x1_010_core : public vgsound_emu_core
 					, m_data(0)
 					, m_vol_out{0}
 					, m_out{0}
+					, m_env_table(nullptr)
+					, m_wave_table(nullptr)
+					, m_step(0)
 				{
 				}
 
 				// internal state
 				void reset();
-				void tick();
+				void tick(u8 voice);
+				void render(u8 voice, s32 *left, s32 *right, u32 samples);
+				void serialize(serializer_t &s);
+
+				// cached table pointers and step
+				void update_table();
+				void update_step();
 
 				// register accessor
 				u8 reg_r(u8 offset);
 				void reg_w(u8 offset, u8 data);
 
 				// getters
+				inline bool keyon() { return m_flag.keyon(); }
+
 				inline s32 out(u8 ch) { return m_out[ch & 1]; }
 
+				// key off voice, output is cleared at next tick
+				inline void skip_idle() { m_out[0] = m_out[1] = 0; }
+
 			private:
 				// host flag
 				x1_010_core &m_host;
@@ -120,6 +142,11 @@ class x1_010_core : public vgsound_emu_core
 
 				// for preview only
 				std::array<s32, 2> m_out = {0};
+
+				// cached from registers
+				u8 *m_env_table	 = nullptr;	 // Envelope table for current shape
+				u8 *m_wave_table = nullptr;	 // Wavetable for current waveform
+				u32 m_step		 = 0;		 // Accumulator step
 		};
 
 	public:
@@ -143,16 +170,27 @@ class x1_010_core : public vgsound_emu_core
 					  *this,
 					  *this}
 			, m_intf(intf)
+			, m_rom(rom_span_t())
 			, m_envelope{0}
 			, m_wave{0}
 			, m_out{0}
+			, m_stats()
+			, m_scope()
+			, m_scope_buf()
 		{
+			for (voice_t &elem : m_voice)
+			{
+				elem.update_table();
+			}
 		}
 
 		// register accessor
 		u8 ram_r(u16 offset);
 		void ram_w(u16 offset, u8 data);
 
+		// direct sample ROM access, bypasses memory interface; nullptr for use memory interface
+		inline void set_rom(const u8 *rom, u32 size) { m_rom.set(rom, size); }
+
 		// getters
 		inline s32 output(u8 ch) { return m_out[ch & 1]; }
 
@@ -160,15 +198,54 @@ class x1_010_core : public vgsound_emu_core
 		void reset();
 		void tick();
 
+		// silence detection for auto sleep, true if every voice is key off
+		bool idle();
+
+		// advance ticks in idle state, same as calling tick() for ticks times
+		void skip_idle(u64 ticks);
+
+		// save state, sample ROM isn't included
+		void serialize(serializer_t &s);
+
+		// render stereo output into buffers, each sample is single tick
+		void render(s32 *left, s32 *right, u32 samples);
+
 		// for preview only
 		inline s32 voice_out(u8 voice, u8 ch)
 		{
 			return (voice < 16) ? m_voice[voice].out(ch & 1) : 0;
 		}
 
+		// instrumentation, counted only if VGSOUND_EMU_ENABLE_STATS is defined
+		typedef core_stats_t<16> stats_t;
+
+		inline const stats_t &stats() { return m_stats; }
+
+		inline void reset_stats() { m_stats.reset(); }
+
+		// per-voice output capture for scope views, disabled by default
+		// one sample per tick, captured as left + right
+		typedef voice_scope_t<16> scope_t;
+
+		inline scope_t &scope() { return m_scope; }
+
 	private:
+		void render_scope(s32 *left, s32 *right, u32 samples);
+
+		inline u8 read_byte(u8 voice, u32 address)
+		{
+			if (m_rom.valid())
+			{
+				m_stats.voice[voice].direct.inc();
+				return m_rom.read_byte(address);
+			}
+			m_stats.voice[voice].read.inc();
+			return m_intf.read_byte(address);
+		}
+
 		std::array<voice_t, 16> m_voice;
 		vgsound_emu_mem_intf &m_intf;
+		rom_span_t m_rom;  // Sample ROM for direct access
 
 		// RAM
 		std::array<u8, 0x1000> m_envelope = {0};
@@ -176,6 +253,11 @@ class x1_010_core : public vgsound_emu_core
 
 		// output data
 		std::array<s32, 2> m_out = {0};
+
+		stats_t m_stats;  // instrumentation counters
+		scope_t m_scope;  // per-voice output capture
+
+		std::array<std::vector<s32>, 2> m_scope_buf;  // per-voice render buffer for capture
 };
 
 #endif